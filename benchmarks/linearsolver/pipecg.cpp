@@ -0,0 +1,122 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Strong scaling of standard versus pipelined preconditioned CG.
+//
+// Usage: benchmark_linearsolver_pipecg [n] [max_threads]
+
+#include <chrono>
+#include <cmath>
+#include <cpe/linearsolver/cg.hpp>
+#include <cpe/linearsolver/pipecg.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// A shifted spring chain: SPD and moderately conditioned, so both solvers
+// converge in a few dozen iterations and the run time is dominated by the
+// per-iteration kernels rather than the iteration count
+cpe::matrix::Matrix BuildMatrix(std::size_t n) {
+  cpe::matrix::Matrix A(n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double k = 1.0 + 0.5 * std::sin(static_cast<double>(i));
+    A[i, i] += k + 0.1;
+    if (i > 0) {
+      A[i - 1, i - 1] += k;
+      A[i - 1, i] -= k;
+      A[i, i - 1] -= k;
+    }
+  }
+  return A;
+}
+
+template <typename F>
+double Time(F&& f, int& iterations) {
+  std::stringstream sink;
+  std::streambuf* original = std::cout.rdbuf(sink.rdbuf());
+  const auto start = std::chrono::steady_clock::now();
+  iterations = f();
+  const auto stop = std::chrono::steady_clock::now();
+  std::cout.rdbuf(original);
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4000;
+  const std::size_t max_threads =
+      argc > 2 ? std::strtoul(argv[2], nullptr, 10)
+               : std::max(1U, std::thread::hardware_concurrency());
+
+  const cpe::matrix::Matrix A = BuildMatrix(n);
+  cpe::matrix::Matrix b(n, 1);
+  for (std::size_t i = 0; i < n; ++i) b[i] = std::cos(static_cast<double>(i));
+  const auto M = cpe::linearsolver::preconditioner::Jacobi(A);
+  constexpr double tolerance = 1.0e-10;
+
+  std::cout << "n = " << n << std::endl;
+  std::cout << std::setw(10) << "Threads";
+  std::cout << std::setw(12) << "CG its";
+  std::cout << std::setw(15) << "CG [s]";
+  std::cout << std::setw(12) << "PipeCG its";
+  std::cout << std::setw(15) << "PipeCG [s]";
+  std::cout << std::setw(15) << "CG / PipeCG";
+  std::cout << std::endl;
+  std::vector<std::size_t> thread_counts;
+  for (std::size_t t = 1; t < max_threads; t *= 2) thread_counts.push_back(t);
+  thread_counts.push_back(max_threads);
+  for (std::size_t num_threads : thread_counts) {
+    cpe::parallel::ThreadPool pool(num_threads);
+    int cg_iterations = 0;
+    int pipecg_iterations = 0;
+    cpe::matrix::Matrix x(n, 1);
+    const double cg_time = Time(
+        [&]() {
+          return cpe::linearsolver::cg::Solve(A, x, b, M, tolerance, &pool);
+        },
+        cg_iterations);
+    x = cpe::matrix::Matrix(n, 1);
+    const double pipecg_time = Time(
+        [&]() {
+          return cpe::linearsolver::pipecg::Solve(A, x, b, M, tolerance,
+                                                  &pool);
+        },
+        pipecg_iterations);
+
+    std::cout << std::setw(10) << num_threads;
+    std::cout << std::setw(12) << cg_iterations;
+    std::cout << std::setprecision(5) << std::scientific;
+    std::cout << std::setw(15) << cg_time;
+    std::cout << std::setw(12) << pipecg_iterations;
+    std::cout << std::setw(15) << pipecg_time;
+    std::cout << std::setprecision(3) << std::fixed;
+    std::cout << std::setw(15) << cg_time / pipecg_time;
+    std::cout << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,111 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// Cost of deterministic versus fast reductions in the threaded dot product.
+//
+// Usage: benchmark_matrix_dot [n] [max_threads] [repetitions]
+
+#include <chrono>
+#include <cmath>
+#include <cpe/matrix/matrix.hpp>
+#include <cpe/parallel/threadpool.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+template <typename F>
+double Time(F&& f, std::size_t repetitions, double& result) {
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t r = 0; r < repetitions; ++r) result = f();
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count() /
+         static_cast<double>(repetitions);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::size_t n =
+      argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  const std::size_t max_threads =
+      argc > 2 ? std::strtoul(argv[2], nullptr, 10)
+               : std::max(1U, std::thread::hardware_concurrency());
+  const std::size_t repetitions =
+      argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 200;
+
+  cpe::matrix::Matrix a(n, 1);
+  cpe::matrix::Matrix b(n, 1);
+  for (std::size_t i = 0; i < n; ++i) {
+    a[i] = std::sin(static_cast<double>(i));
+    b[i] = std::cos(static_cast<double>(3 * i));
+  }
+  double serial_result = 0.0;
+  const double serial_time =
+      Time([&]() { return cpe::matrix::Dot(a, b); }, repetitions,
+           serial_result);
+
+  std::cout << "n = " << n << ", serial = " << std::setprecision(5)
+            << std::scientific << serial_time << " s" << std::endl;
+  std::cout << std::setw(10) << "Threads";
+  std::cout << std::setw(15) << "Fast [s]";
+  std::cout << std::setw(15) << "Determ. [s]";
+  std::cout << std::setw(15) << "Overhead";
+  std::cout << std::setw(15) << "Fast diff";
+  std::cout << std::setw(15) << "Determ. diff";
+  std::cout << std::endl;
+  std::vector<std::size_t> thread_counts;
+  for (std::size_t t = 1; t < max_threads; t *= 2) thread_counts.push_back(t);
+  thread_counts.push_back(max_threads);
+  double deterministic_reference = 0.0;
+  for (std::size_t num_threads : thread_counts) {
+    cpe::parallel::ThreadPool fast(num_threads);
+    cpe::parallel::ThreadPool deterministic(
+        num_threads, cpe::parallel::Reduction::kDeterministic);
+    double fast_result = 0.0;
+    double deterministic_result = 0.0;
+    const double fast_time =
+        Time([&]() { return cpe::matrix::Dot(a, b, fast); }, repetitions,
+             fast_result);
+    const double deterministic_time =
+        Time([&]() { return cpe::matrix::Dot(a, b, deterministic); },
+             repetitions, deterministic_result);
+    if (num_threads == 1) deterministic_reference = deterministic_result;
+
+    // Differences from the serial and one thread results show which mode
+    // reproduces itself across thread counts
+    std::cout << std::setw(10) << num_threads;
+    std::cout << std::setprecision(5) << std::scientific;
+    std::cout << std::setw(15) << fast_time;
+    std::cout << std::setw(15) << deterministic_time;
+    std::cout << std::setprecision(3) << std::fixed;
+    std::cout << std::setw(15) << deterministic_time / fast_time;
+    std::cout << std::setprecision(3) << std::scientific;
+    std::cout << std::setw(15) << fast_result - serial_result;
+    std::cout << std::setw(15)
+              << deterministic_result - deterministic_reference;
+    std::cout << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,128 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// Scaling of colored element assembly with the number of threads.
+//
+// Usage: benchmark_model_assemble [n] [max_threads] [repetitions]
+
+#include <chrono>
+#include <cpe/matrix/matrix.hpp>
+#include <cpe/model/element.hpp>
+#include <cpe/model/elementblock.hpp>
+#include <cpe/model/material.hpp>
+#include <cpe/model/nodelist.hpp>
+#include <cpe/model/property.hpp>
+#include <cpe/parallel/threadpool.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+
+// Cube of n by n by n nodes, each joined to its neighbours along the axes and
+// the face diagonals
+void BuildLattice(std::size_t n, cpe::model::NodeList& nodes,
+                  ElementBlock& block) {
+  const auto Id = [n](std::size_t i, std::size_t j, std::size_t k) {
+    return (i * n + j) * n + k;
+  };
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t k = 0; k < n; ++k) {
+        const std::size_t id = Id(i, j, k);
+        nodes.AddNode(id, 1.0 * i, 1.0 * j, 1.0 * k);
+        for (std::size_t d = 0; d < 3; ++d) {
+          nodes[id].global_dof_index_[d] = 3 * id + d;
+        }
+        if (i + 1 < n) block.AddElement(id, Id(i + 1, j, k));
+        if (j + 1 < n) block.AddElement(id, Id(i, j + 1, k));
+        if (k + 1 < n) block.AddElement(id, Id(i, j, k + 1));
+        if (i + 1 < n && j + 1 < n) block.AddElement(id, Id(i + 1, j + 1, k));
+        if (j + 1 < n && k + 1 < n) block.AddElement(id, Id(i, j + 1, k + 1));
+        if (i + 1 < n && k + 1 < n) block.AddElement(id, Id(i + 1, j, k + 1));
+      }
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10;
+  const std::size_t max_threads =
+      argc > 2 ? std::strtoul(argv[2], nullptr, 10)
+               : std::max(1U, std::thread::hardware_concurrency());
+  const std::size_t repetitions =
+      argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 20;
+
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Steel", 200.0e9, 0.3);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("bar", material);
+  (*property)["area"] = 1.0e-4;
+  cpe::model::NodeList nodes(n * n * n);
+  ElementBlock block("lattice", property);
+  BuildLattice(n, nodes, block);
+  const std::size_t num_dof = 3 * nodes.GetNumNodes();
+  cpe::matrix::Matrix stiffness(num_dof, num_dof);
+
+  // The first call builds the slot map and the colors
+  const auto setup_start = std::chrono::steady_clock::now();
+  block.Assemble(nodes, stiffness);
+  const auto setup_stop = std::chrono::steady_clock::now();
+  std::cout << "elements = " << block.GetNumElements()
+            << ", colors = " << block.GetColors().size() << ", setup = "
+            << std::setprecision(5) << std::scientific
+            << std::chrono::duration<double>(setup_stop - setup_start).count()
+            << " s" << std::endl;
+
+  std::cout << std::setw(10) << "Threads";
+  std::cout << std::setw(15) << "Time [s]";
+  std::cout << std::setw(15) << "Speedup";
+  std::cout << std::endl;
+  std::vector<std::size_t> thread_counts;
+  for (std::size_t t = 1; t < max_threads; t *= 2) thread_counts.push_back(t);
+  thread_counts.push_back(max_threads);
+  double serial_time = 0.0;
+  for (std::size_t num_threads : thread_counts) {
+    cpe::parallel::ThreadPool pool(num_threads);
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < repetitions; ++r) {
+      block.Assemble(nodes, stiffness, &pool);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const double time = std::chrono::duration<double>(stop - start).count() /
+                        static_cast<double>(repetitions);
+    if (num_threads == 1) serial_time = time;
+    std::cout << std::setw(10) << num_threads;
+    std::cout << std::setprecision(5) << std::scientific;
+    std::cout << std::setw(15) << time;
+    std::cout << std::setprecision(3) << std::fixed;
+    std::cout << std::setw(15) << serial_time / time;
+    std::cout << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,97 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// Cost of node id lookups against a std::map, for compact and scattered ids.
+//
+// Usage: benchmark_model_lookup [num_nodes] [num_lookups]
+
+#include <algorithm>
+#include <chrono>
+#include <cpe/model/nodelist.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+template <typename F>
+double Time(F&& f) {
+  const auto start = std::chrono::steady_clock::now();
+  f();
+  const auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const std::size_t num_nodes =
+      argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+  const std::size_t num_lookups =
+      argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000000;
+
+  std::cout << std::setw(12) << "Ids";
+  std::cout << std::setw(15) << "map [ns]";
+  std::cout << std::setw(15) << "NodeList [ns]";
+  std::cout << std::setw(15) << "Batch [ns]";
+  std::cout << std::endl;
+  std::mt19937_64 generator(5489u);
+  for (bool compact : {true, false}) {
+    std::vector<std::size_t> ids(num_nodes);
+    for (std::size_t i = 0; i < num_nodes; ++i) {
+      ids[i] = compact ? i + 1 : generator() >> 16;
+    }
+    std::shuffle(ids.begin(), ids.end(), generator);
+    std::map<std::size_t, std::size_t> map;
+    cpe::model::NodeList nodes(num_nodes);
+    for (std::size_t i = 0; i < num_nodes; ++i) {
+      if (map.emplace(ids[i], nodes.GetNumNodes()).second) {
+        nodes.AddNode(ids[i], 0.0);
+      }
+    }
+    std::vector<std::size_t> queries(num_lookups);
+    std::uniform_int_distribution<std::size_t> pick(0, num_nodes - 1);
+    for (std::size_t& query : queries) query = ids[pick(generator)];
+    std::vector<std::size_t> indices(num_lookups);
+
+    std::size_t check = 0;
+    const double map_time = Time([&]() {
+      for (std::size_t query : queries) check += map.at(query);
+    });
+    const double list_time = Time([&]() {
+      for (std::size_t query : queries) check -= nodes.GetNodeIndex(query);
+    });
+    const double batch_time =
+        Time([&]() { nodes.GetNodeIndices(queries, indices); });
+    const double scale = 1.0e9 / static_cast<double>(num_lookups);
+    std::cout << std::setw(12) << (compact ? "compact" : "scattered");
+    std::cout << std::setprecision(2) << std::fixed;
+    std::cout << std::setw(15) << map_time * scale;
+    std::cout << std::setw(15) << list_time * scale;
+    std::cout << std::setw(15) << batch_time * scale;
+    std::cout << std::endl;
+    if (check != 0) std::cout << "Lookups disagree" << std::endl;
+  }
+  return 0;
+}
@@ -8,6 +8,9 @@ endif()
 
 h1("Project: ${_project} v${_version} (${CMAKE_BUILD_TYPE})")
 
+option(CPE_DO_BENCHMARKS "Build the benchmarks" ON)
+message(STATUS "Option CPE_DO_BENCHMARKS: ${CPE_DO_BENCHMARKS}")
+
 option(CPE_DO_SYSTEM_TESTS "Build the system tests" ON)
 message(STATUS "Option CPE_DO_SYSTEM_TESTS: ${CPE_DO_SYSTEM_TESTS}")
 
@@ -22,6 +22,7 @@
 #include <cpe/io/vtk.hpp>
 #include <iomanip>
 #include <limits>
+#include <span>
 
 namespace cpe::io::vtk {
 
@@ -29,6 +30,13 @@ static unsigned int double_precision =
     std::numeric_limits<double>::max_digits10;
 static unsigned int double_width = 24;
 
+// Inactive dof have no value and are written as zero
+static double GetValue(const cpe::matrix::Matrix& values, std::size_t dof,
+                       std::size_t column = 0) {
+  if (dof == cpe::model::dof::kInactiveDof) return 0.0;
+  return values[dof, column];
+}
+
 void WriteVtuCells(std::ostream& os, const cpe::model::Model& model,
                    int level = 0, int indent = 2) {
   std::string pre(indent * level, ' ');
@@ -41,19 +49,21 @@ void WriteVtuCells(std::ostream& os, const cpe::model::Model& model,
 
   os << pre << ind
      << "<DataArray type=\"Int64\" Name=\"connectivity\" format=\"ascii\">\n";
+  std::size_t cell = 0;
+  std::size_t offset = 0;
   for (std::size_t i = 0; i < model.blocks_.size(); ++i) {
     auto& block = *(model.blocks_[i]);
-    for (std::size_t j = 0; j < block.GetNumElements(); ++j) {
+    const std::span<const std::uint8_t> vtk_order = block.GetVtkOrder();
+    for (std::size_t j = 0; j < block.GetNumElements(); ++j, ++cell) {
+      const std::span<const std::size_t> ids = block.GetElementNodes(j);
       os << pre << ind;
-      for (unsigned int k = 0; k < block[j].GetNumNodes(); ++k) {
-        std::size_t elem_node_index = block[j].kVtkOrder[k];
-        std::size_t node_id = block[j][elem_node_index];
-        os << ind << model.nodes_.GetNodeIndex(node_id);
+      for (std::uint8_t elem_node_index : vtk_order) {
+        os << ind << model.nodes_.GetNodeIndex(ids[elem_node_index]);
       }
       os << "\n";
-      if (j >= 1) offsets[j] = offsets[j - 1];
-      offsets[j] += block[j].GetNumNodes();
-      types[j] = block[j].kVtkType;
+      offset += ids.size();
+      offsets[cell] = offset;
+      types[cell] = block.GetVtkType();
     }
   }
   os << pre << ind << "</DataArray>\n";
@@ -89,9 +99,9 @@ void WriteVtuPointData(std::ostream& os, const cpe::model::Model& model,
     std::size_t ix = dofs[cpe::model::dof::kIx];
     std::size_t iy = dofs[cpe::model::dof::kIy];
     std::size_t iz = dofs[cpe::model::dof::kIz];
-    os << pre << ind << ind << std::setw(double_width) << gdof[ix]
-       << ind << std::setw(double_width) << gdof[iy] << ind
-       << std::setw(double_width) << gdof[iz] << "\n";
+    os << pre << ind << ind << std::setw(double_width) << GetValue(gdof, ix)
+       << ind << std::setw(double_width) << GetValue(gdof, iy) << ind
+       << std::setw(double_width) << GetValue(gdof, iz) << "\n";
   }
   os << pre << ind << "</DataArray>\n";
 
@@ -103,9 +113,9 @@ void WriteVtuPointData(std::ostream& os, const cpe::model::Model& model,
     std::size_t idx = dofs[cpe::model::dof::kIdx];
     std::size_t idy = dofs[cpe::model::dof::kIdy];
     std::size_t idz = dofs[cpe::model::dof::kIdz];
-    os << pre << ind << ind << std::setw(double_width) << gdof[idx]
-       << ind << std::setw(double_width) << gdof[idy] << ind
-       << std::setw(double_width) << gdof[idz] << "\n";
+    os << pre << ind << ind << std::setw(double_width) << GetValue(gdof, idx)
+       << ind << std::setw(double_width) << GetValue(gdof, idy) << ind
+       << std::setw(double_width) << GetValue(gdof, idz) << "\n";
   }
   os << pre << ind << "</DataArray>\n";
 
@@ -118,9 +128,9 @@ void WriteVtuPointData(std::ostream& os, const cpe::model::Model& model,
     std::size_t ix = dofs[cpe::model::dof::kIx];
     std::size_t iy = dofs[cpe::model::dof::kIy];
     std::size_t iz = dofs[cpe::model::dof::kIz];
-    os << pre << ind << ind << std::setw(double_width) << aforce[ix]
-       << ind << std::setw(double_width) << aforce[iy] << ind
-       << std::setw(double_width) << aforce[iz] << "\n";
+    os << pre << ind << ind << std::setw(double_width) << GetValue(aforce, ix)
+       << ind << std::setw(double_width) << GetValue(aforce, iy) << ind
+       << std::setw(double_width) << GetValue(aforce, iz) << "\n";
   }
   os << pre << ind << "</DataArray>\n";
 
@@ -132,15 +142,54 @@ void WriteVtuPointData(std::ostream& os, const cpe::model::Model& model,
     std::size_t idx = dofs[cpe::model::dof::kIdx];
     std::size_t idy = dofs[cpe::model::dof::kIdy];
     std::size_t idz = dofs[cpe::model::dof::kIdz];
-    os << pre << ind << ind << std::setw(double_width) << aforce[idx]
-       << ind << std::setw(double_width) << aforce[idy] << ind
-       << std::setw(double_width) << aforce[idz] << "\n";
+    os << pre << ind << ind << std::setw(double_width) << GetValue(aforce, idx)
+       << ind << std::setw(double_width) << GetValue(aforce, idy) << ind
+       << std::setw(double_width) << GetValue(aforce, idz) << "\n";
   }
   os << pre << ind << "</DataArray>\n";
 
+  if (model.mode_shapes_) {
+    auto& modes = *(model.mode_shapes_);
+    for (std::size_t m = 0; m < modes.GetNumColumns(); ++m) {
+      os << pre << ind << "<DataArray Name=\"Mode " << m + 1
+         << "\" type=\"Float64\" NumberOfComponents=\"3\" "
+            "format=\"ascii\">\n";
+      for (std::size_t i = 0; i < model.GetNumNodes(); ++i) {
+        auto& dofs = model.nodes_[i].global_dof_index_;
+        std::size_t ix = dofs[cpe::model::dof::kIx];
+        std::size_t iy = dofs[cpe::model::dof::kIy];
+        std::size_t iz = dofs[cpe::model::dof::kIz];
+        os << pre << ind << ind << std::setw(double_width)
+           << GetValue(modes, ix, m) << ind << std::setw(double_width)
+           << GetValue(modes, iy, m) << ind << std::setw(double_width)
+           << GetValue(modes, iz, m) << "\n";
+      }
+      os << pre << ind << "</DataArray>\n";
+    }
+  }
+
   os << pre << "</PointData>\n";
 }
 
+void WriteVtuFieldData(std::ostream& os, const cpe::model::Model& model,
+                       int level = 0, int indent = 2) {
+  std::string pre(indent * level, ' ');
+  std::string ind(indent, ' ');
+
+  os << std::scientific << std::setprecision(double_precision);
+  os << pre << "<FieldData>\n";
+  auto& frequencies = *(model.frequencies_);
+  os << pre << ind
+     << "<DataArray Name=\"Frequency\" type=\"Float64\" NumberOfTuples=\""
+     << frequencies.GetNumRows() << "\" format=\"ascii\">\n";
+  for (std::size_t m = 0; m < frequencies.GetNumRows(); ++m) {
+    os << pre << ind << ind << std::setw(double_width) << frequencies[m]
+       << "\n";
+  }
+  os << pre << ind << "</DataArray>\n";
+  os << pre << "</FieldData>\n";
+}
+
 void WriteVtuPoints(std::ostream& os, const cpe::model::Model& model,
                     int level = 0, int indent = 2) {
   std::string pre(indent * level, ' ');
@@ -152,10 +201,13 @@ void WriteVtuPoints(std::ostream& os, const cpe::model::Model& model,
      << "<DataArray type=\"Float64\" NumberOfComponents=\"3\" "
         "format=\"ascii\">\n";
 
+  std::span<const double> x = model.nodes_.GetX();
+  std::span<const double> y = model.nodes_.GetY();
+  std::span<const double> z = model.nodes_.GetZ();
   for (std::size_t i = 0; i < model.GetNumNodes(); ++i) {
-    os << pre << ind << ind << std::setw(double_width) << model.nodes_[i].x_
-       << ind << std::setw(double_width) << model.nodes_[i].y_ << ind
-       << std::setw(double_width) << model.nodes_[i].z_ << "\n";
+    os << pre << ind << ind << std::setw(double_width) << x[i] << ind
+       << std::setw(double_width) << y[i] << ind << std::setw(double_width)
+       << z[i] << "\n";
   }
 
   os << pre << ind << "</DataArray>\n";
@@ -174,6 +226,7 @@ void WriteVtu(std::ostream& os, const cpe::model::Model& model) {
   os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
   os << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\">\n";
   os << "  <UnstructuredGrid>\n";
+  if (model.frequencies_) WriteVtuFieldData(os, model, 2);
   os << "    <Piece NumberOfPoints=\"" << model.GetNumNodes()
      << "\" NumberOfCells=\"" << model.GetNumElements() << "\">\n";
 
@@ -112,4 +112,41 @@ TEST(VTKTest, WriteVtu) {
   EXPECT_EQ(os.str(), expected);
 }
 
+TEST(VTKTest, WriteVtuModes) {
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Aluminum", 70.0e9, 0.3, 2700.0);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 1.0;
+
+  cpe::model::Model model;
+  model.nodes_.AddNode(0, -1.0, 0.0, 0.0);
+  model.nodes_.AddNode(1, 1.0, 0.0, 0.0);
+  model.nodes_.AddNode(2, 0.0, 1.0, 0.0);
+  using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+  std::shared_ptr<ElementBlock> block =
+      std::make_shared<ElementBlock>("truss", property, 8);
+  model.blocks_.push_back(block);
+  block->AddElement(0, 1);
+  block->AddElement(1, 2);
+  block->AddElement(0, 2);
+  model.AddConstraint(cpe::model::dof::kAllNon2d, 0.0);
+  model.AddConstraint(cpe::model::dof::kAll, 0.0, 0);
+  model.AddConstraint(cpe::model::dof::kY, 0.0, 1);
+  model.Assemble();
+  model.AssembleMass();
+  ASSERT_GT(model.SolveModes(2), 0);
+
+  std::stringstream os;
+  cpe::io::vtk::WriteVtu(os, model);
+  const std::string vtu = os.str();
+  EXPECT_NE(vtu.find("<FieldData>"), std::string::npos);
+  EXPECT_NE(vtu.find("Name=\"Frequency\""), std::string::npos);
+  EXPECT_NE(vtu.find("NumberOfTuples=\"2\""), std::string::npos);
+  EXPECT_NE(vtu.find("Name=\"Mode 1\""), std::string::npos);
+  EXPECT_NE(vtu.find("Name=\"Mode 2\""), std::string::npos);
+  EXPECT_EQ(vtu.find("Name=\"Mode 3\""), std::string::npos);
+  EXPECT_LT(vtu.find("</FieldData>"), vtu.find("<Piece"));
+}
+
 }  // namespace
@@ -0,0 +1,185 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <algorithm>
+#include <cmath>
+#include <cpe/linearsolver/anderson.hpp>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace cpe::linearsolver::anderson {
+
+namespace {
+
+using cpe::matrix::Matrix;
+
+// Solves min |f - dF gamma| by modified Gram-Schmidt on the columns of dF.
+// Returns false if the columns are numerically dependent.
+bool LeastSquares(const std::deque<Matrix>& dF, const Matrix& f,
+                  std::vector<double>& gamma) {
+  const std::size_t m = dF.size();
+  const std::size_t n = f.GetNumRows();
+  std::vector<Matrix> Q(dF.begin(), dF.end());
+  Matrix R(m, m);
+  for (std::size_t j = 0; j < m; ++j) {
+    const double original = std::sqrt(cpe::matrix::Dot(Q[j], Q[j]));
+    for (std::size_t k = 0; k < j; ++k) {
+      R[k, j] = cpe::matrix::Dot(Q[k], Q[j]);
+      for (std::size_t i = 0; i < n; ++i) Q[j][i] -= R[k, j] * Q[k][i];
+    }
+    R[j, j] = std::sqrt(cpe::matrix::Dot(Q[j], Q[j]));
+    if (!(R[j, j] > 1.0e-10 * original)) return false;
+    Q[j] *= 1.0 / R[j, j];
+  }
+  gamma.assign(m, 0.0);
+  for (std::size_t j = m; j-- > 0;) {
+    double value = cpe::matrix::Dot(Q[j], f);
+    for (std::size_t k = j + 1; k < m; ++k) value -= R[j, k] * gamma[k];
+    gamma[j] = value / R[j, j];
+  }
+  return true;
+}
+
+}  // namespace
+
+int Solve(const Matrix& A, Matrix& x, const Matrix& b, const FixedPoint& G,
+          double tolerance, std::size_t depth) {
+  constexpr double min_value = 1.0e-12;
+  const std::size_t n = A.GetNumRows();
+  std::deque<Matrix> dF;
+  std::deque<Matrix> dG;
+  std::vector<double> gamma;
+  Matrix g(n, 1);
+  Matrix f(n, 1);
+  Matrix previous_g(n, 1);
+  Matrix previous_f(n, 1);
+  Matrix residual(n, 1);
+  bool has_previous = false;
+  double previous_update = 0.0;
+
+  std::cout << std::setw(10) << "Iteration";
+  std::cout << std::setw(15) << "|R|";
+  std::cout << std::setw(15) << "|R| / |x|";
+  std::cout << std::setw(15) << "|dx|";
+  std::cout << std::setw(15) << "|dx| / |x|";
+  std::cout << std::endl;
+  std::cout << std::setw(10) << "---------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::endl;
+
+  constexpr int maximum_iterations = 1000;
+  int iteration_count = 0;
+  bool converged = false;
+  for (std::size_t it = 0; it < maximum_iterations; ++it) {
+    iteration_count++;
+
+    g = x;
+    G(g);
+    for (std::size_t i = 0; i < n; ++i) f[i] = g[i] - x[i];
+    double update_absolute_error = std::sqrt(cpe::matrix::Dot(f, f));
+
+    // Safeguard: mixing is not monotone, but an accelerated step that grew the
+    // update markedly is discarded in favour of the plain sweep from the
+    // previous iterate
+    if (has_previous && !(update_absolute_error < 2.0 * previous_update)) {
+      dF.clear();
+      dG.clear();
+      x = previous_g;
+      g = x;
+      G(g);
+      iteration_count++;
+      for (std::size_t i = 0; i < n; ++i) f[i] = g[i] - x[i];
+      update_absolute_error = std::sqrt(cpe::matrix::Dot(f, f));
+      has_previous = false;
+    }
+
+    cpe::matrix::Multiply(A, x, residual);
+    double residual_absolute_error = 0.0;
+    double residual_relative_error = 0.0;
+    double update_relative_error = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      residual[i] = b[i] - residual[i];
+      residual_absolute_error += (residual[i] * residual[i]);
+      residual_relative_error +=
+          (residual[i] * residual[i]) / std::max(x[i] * x[i], min_value);
+      update_relative_error +=
+          (f[i] * f[i]) / std::max(x[i] * x[i], min_value);
+    }
+    residual_absolute_error = std::sqrt(residual_absolute_error);
+    residual_relative_error = std::sqrt(residual_relative_error);
+    update_relative_error = std::sqrt(update_relative_error);
+
+    std::cout << std::setw(10) << iteration_count;
+    std::cout << std::setprecision(5) << std::scientific;
+    std::cout << std::setw(15) << residual_absolute_error;
+    std::cout << std::setw(15) << residual_relative_error;
+    std::cout << std::setw(15) << update_absolute_error;
+    std::cout << std::setw(15) << update_relative_error;
+    std::cout << std::endl;
+
+    if (!std::isfinite(update_absolute_error)) break;
+    converged = update_absolute_error <= tolerance;
+    if (converged) {
+      x = g;
+      break;
+    }
+
+    if (has_previous && depth > 0) {
+      dF.emplace_back(n, 1);
+      dG.emplace_back(n, 1);
+      for (std::size_t i = 0; i < n; ++i) {
+        dF.back()[i] = f[i] - previous_f[i];
+        dG.back()[i] = g[i] - previous_g[i];
+      }
+      if (dF.size() > depth) {
+        dF.pop_front();
+        dG.pop_front();
+      }
+    }
+    previous_f = f;
+    previous_g = g;
+    previous_update = update_absolute_error;
+    has_previous = true;
+
+    // x = g - dG gamma, restarting from the plain sweep if the history has
+    // become dependent
+    x = g;
+    if (!dF.empty()) {
+      if (LeastSquares(dF, f, gamma)) {
+        for (std::size_t j = 0; j < dG.size(); ++j) {
+          for (std::size_t i = 0; i < n; ++i) x[i] -= gamma[j] * dG[j][i];
+        }
+      } else {
+        dF.clear();
+        dG.clear();
+      }
+    }
+  }
+
+  return converged ? iteration_count : -1;
+}
+
+}  // namespace cpe::linearsolver::anderson
@@ -0,0 +1,42 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpe/matrix/matrix.hpp>
+#include <functional>
+
+namespace cpe::linearsolver::anderson {
+
+// One sweep x <- G(x) of a stationary iteration, e.g.
+//   [&](Matrix& x) { gaussseidel::Sweep(A, x, b); }
+using FixedPoint = std::function<void(cpe::matrix::Matrix& x)>;
+
+// Anderson acceleration of the fixed-point iteration G.  Each step mixes the
+// last depth sweeps to minimize the combined update G(x) - x.  A step that
+// doubles the update is replaced by a plain sweep, and the history is
+// restarted whenever a step is rejected or it becomes linearly dependent.
+// Returns the number of sweeps, or -1.
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, const FixedPoint& G,
+          double tolerance = 1.0e-6, std::size_t depth = 5);
+
+}  // namespace cpe::linearsolver::anderson
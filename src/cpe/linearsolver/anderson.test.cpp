@@ -0,0 +1,113 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cpe/linearsolver/anderson.hpp>
+#include <cpe/linearsolver/gaussseidel.hpp>
+#include <cpe/linearsolver/jacobi.hpp>
+#include <cpe/linearsolver/lu.hpp>
+#include <cpe/linearsolver/springchain.test.hpp>
+#include <cpe/linearsolver/ssor.hpp>
+
+namespace {
+
+using cpe::matrix::Matrix;
+
+using cpe::linearsolver::testing::SpringChain;
+
+TEST(AndersonTest, Solve) {
+  Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  Matrix x(5, 1);
+  int num_iter = cpe::linearsolver::anderson::Solve(
+      A, x, b, [&](Matrix& y) { cpe::linearsolver::jacobi::Sweep(A, y, b); },
+      1.0e-6);
+  EXPECT_GT(num_iter, 0);
+  EXPECT_LT(num_iter, 18);
+  EXPECT_NEAR(x[0], 25.000000, 0.0001);
+  EXPECT_NEAR(x[1], 35.714285, 0.0001);
+  EXPECT_NEAR(x[2], 42.857143, 0.0001);
+  EXPECT_NEAR(x[3], 35.714285, 0.0001);
+  EXPECT_NEAR(x[4], 25.000000, 0.0001);
+}
+
+TEST(AndersonTest, Accelerate) {
+  constexpr std::size_t n = 40;
+  Matrix A = SpringChain(n, 0.5);
+  Matrix b(n, 1);
+  b[n - 1] = 1.0;
+  Matrix x_ref(n, 1);
+  ASSERT_GT(cpe::linearsolver::lu::Solve(A, x_ref, b), 0);
+
+  // Plain Gauss-Seidel stagnates on this problem
+  Matrix x_gs(n, 1);
+  int gs_iter = cpe::linearsolver::gaussseidel::Solve(A, x_gs, b, 1.0e-8);
+  EXPECT_EQ(gs_iter, -1);
+
+  using cpe::linearsolver::anderson::FixedPoint;
+  std::vector<FixedPoint> sweeps = {
+      [&](Matrix& y) { cpe::linearsolver::jacobi::Sweep(A, y, b); },
+      [&](Matrix& y) { cpe::linearsolver::gaussseidel::Sweep(A, y, b); },
+      [&](Matrix& y) { cpe::linearsolver::ssor::Sweep(A, y, b, 1.5); }};
+  for (const FixedPoint& G : sweeps) {
+    Matrix x(n, 1);
+    int num_iter = cpe::linearsolver::anderson::Solve(A, x, b, G, 1.0e-8, 10);
+    EXPECT_GT(num_iter, 0);
+    EXPECT_LT(num_iter, 250);
+    for (std::size_t i = 0; i < n; ++i) EXPECT_NEAR(x[i], x_ref[i], 1.0e-5);
+  }
+}
+
+TEST(AndersonTest, Restart) {
+  constexpr std::size_t n = 40;
+  Matrix A = SpringChain(n, 0.5);
+  Matrix b(n, 1);
+  b[n - 1] = 1.0;
+  // A depth beyond the problem size forces dependent histories
+  Matrix x(n, 1);
+  int num_iter = cpe::linearsolver::anderson::Solve(
+      A, x, b,
+      [&](Matrix& y) { cpe::linearsolver::gaussseidel::Sweep(A, y, b); },
+      1.0e-8, 2 * n);
+  EXPECT_GT(num_iter, 0);
+}
+
+TEST(AndersonTest, Fail) {
+  Matrix A(2, 2);
+  A[0, 0] = A[1, 1] = 1.0;
+  A[0, 1] = A[1, 0] = 2.0;
+  Matrix b(2, 1);
+  b[0] = b[1] = 1.0;
+  // Without mixing this is plain Jacobi, which diverges
+  Matrix x(2, 1);
+  int num_iter = cpe::linearsolver::anderson::Solve(
+      A, x, b, [&](Matrix& y) { cpe::linearsolver::jacobi::Sweep(A, y, b); },
+      1.0e-6, 0);
+  EXPECT_EQ(num_iter, -1);
+}
+
+}  // namespace
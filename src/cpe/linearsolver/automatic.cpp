@@ -0,0 +1,224 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <algorithm>
+#include <cmath>
+#include <cpe/linearsolver/automatic.hpp>
+#include <cpe/linearsolver/cg.hpp>
+#include <cpe/linearsolver/chebyshev.hpp>
+#include <cpe/linearsolver/lu.hpp>
+#include <cpe/linearsolver/preconditioner.hpp>
+#include <cpe/linearsolver/skyline.hpp>
+#include <cpe/linearsolver/ssor.hpp>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+namespace cpe::linearsolver::automatic {
+
+const char* GetName(Method method) {
+  switch (method) {
+    case Method::kAutomatic:
+      return "automatic";
+    case Method::kDenseDirect:
+      return "dense direct (lu)";
+    case Method::kSparseDirect:
+      return "sparse direct (skyline)";
+    case Method::kKrylov:
+      return "krylov (jacobi cg)";
+    case Method::kStationary:
+      return "stationary (ssor)";
+  }
+  return "unknown";
+}
+
+Analysis Analyze(const cpe::matrix::Matrix& A) {
+  Analysis analysis;
+  const std::size_t n = A.GetNumRows();
+  analysis.num_rows_ = n;
+  analysis.symmetric_ = true;
+  analysis.diagonally_dominant_ = true;
+  for (std::size_t i = 0; i < n; ++i) {
+    double off_diagonal = 0.0;
+    for (std::size_t j = 0; j < n; ++j) {
+      const double value = A[i, j];
+      if (value != 0.0) analysis.num_nonzeros_++;
+      if (j != i) off_diagonal += std::fabs(value);
+      // Assembly may round the two triangles differently
+      if (j < i) {
+        const double transpose = A[j, i];
+        const double scale = std::max(std::fabs(value), std::fabs(transpose));
+        if (std::fabs(value - transpose) > kSymmetryTolerance * scale) {
+          analysis.symmetric_ = false;
+        }
+      }
+    }
+    if (std::fabs(A[i, i]) < off_diagonal) {
+      analysis.diagonally_dominant_ = false;
+    }
+  }
+  if (n > 0) {
+    analysis.density_ = static_cast<double>(analysis.num_nonzeros_) /
+                        (static_cast<double>(n) * static_cast<double>(n));
+  }
+  if (analysis.symmetric_) {
+    analysis.profile_size_ = skyline::GetProfileSize(A);
+    const chebyshev::Bounds bounds = chebyshev::EstimateBounds(A);
+    analysis.condition_estimate_ =
+        bounds.lower_ > 0.0 ? bounds.upper_ / bounds.lower_
+                            : std::numeric_limits<double>::infinity();
+  }
+  return analysis;
+}
+
+Report Select(const Analysis& analysis, const Thresholds& thresholds) {
+  Report report;
+  report.analysis_ = analysis;
+  std::stringstream rationale;
+  if (analysis.num_rows_ <= thresholds.dense_rows_) {
+    report.method_ = Method::kDenseDirect;
+    rationale << analysis.num_rows_
+              << " rows is small enough to factor densely";
+  } else if (analysis.density_ >= thresholds.dense_density_) {
+    report.method_ = Method::kDenseDirect;
+    rationale << "the matrix is " << 100.0 * analysis.density_
+              << "% full, so sparsity cannot be exploited";
+  } else if (!analysis.symmetric_) {
+    report.method_ = Method::kDenseDirect;
+    rationale << "the matrix is not symmetric, so cholesky and cg do not apply";
+  } else if (analysis.num_rows_ <= thresholds.sparse_rows_) {
+    report.method_ = Method::kSparseDirect;
+    rationale << "the profile holds " << analysis.profile_size_
+              << " entries for " << analysis.num_rows_ << " rows";
+  } else if (analysis.profile_size_ <= thresholds.profile_size_ &&
+             (analysis.condition_estimate_ > thresholds.ill_conditioned_ ||
+              !analysis.diagonally_dominant_)) {
+    report.method_ = Method::kSparseDirect;
+    rationale << "the matrix is large but "
+              << (analysis.diagonally_dominant_ ? ""
+                                                : "not diagonally dominant, ")
+              << "has condition estimate " << analysis.condition_estimate_
+              << ", and its profile of " << analysis.profile_size_
+              << " entries fits";
+  } else {
+    report.method_ = Method::kKrylov;
+    rationale << "the matrix is large and sparse with condition estimate "
+              << analysis.condition_estimate_;
+  }
+  report.rationale_ = rationale.str();
+  return report;
+}
+
+bool Solver::Setup(const cpe::matrix::Matrix& A, double tolerance,
+                   Method method, const Thresholds& thresholds) {
+  Reset();
+  if (method == Method::kAutomatic) {
+    report_ = Select(Analyze(A), thresholds);
+  } else {
+    report_ = Report();
+    report_.method_ = method;
+    report_.rationale_ = "requested";
+  }
+  std::cout << "Solver: " << GetName(report_.method_) << ", "
+            << report_.rationale_ << std::endl;
+  A_ = &A;
+  tolerance_ = tolerance;
+  if (Factor()) return true;
+  A_ = nullptr;
+  return false;
+}
+
+void Solver::Reset() {
+  A_ = nullptr;
+  jacobi_ = nullptr;
+  lu_ = lu::Factorization<double>();
+  skyline_ = skyline::Factorization();
+}
+
+bool Solver::Factor() {
+  switch (report_.method_) {
+    case Method::kAutomatic:
+    case Method::kDenseDirect:
+      return lu_.Factor(*A_);
+    case Method::kSparseDirect:
+      if (skyline_.Factor(*A_)) return true;
+      report_.method_ = Method::kDenseDirect;
+      report_.rationale_ += "; cholesky failed, fell back to lu";
+      return lu_.Factor(*A_);
+    case Method::kKrylov:
+      jacobi_ = preconditioner::Jacobi(*A_);
+      return true;
+    case Method::kStationary:
+      return true;
+  }
+  return false;
+}
+
+int Solver::Solve(cpe::matrix::Matrix& x, const cpe::matrix::Matrix& b) {
+  if (!A_) return -1;
+  int result = -1;
+  switch (report_.method_) {
+    case Method::kAutomatic:
+    case Method::kDenseDirect:
+      x = b;
+      lu_.Solve(x);
+      result = 1;
+      break;
+    case Method::kSparseDirect:
+      x = b;
+      skyline_.Solve(x);
+      result = 1;
+      break;
+    case Method::kKrylov:
+      result = cg::Solve(*A_, x, b, jacobi_, tolerance_);
+      if (result < 0) {
+        // Later solves go straight to the factorization
+        report_.method_ = Method::kSparseDirect;
+        report_.rationale_ += "; cg did not converge, fell back to skyline";
+        if (!Factor()) {
+          A_ = nullptr;
+          break;
+        }
+        return Solve(x, b);
+      }
+      break;
+    case Method::kStationary:
+      result = ssor::Solve(*A_, x, b, tolerance_, 1.5);
+      break;
+  }
+  report_.iterations_ = result;
+  return result;
+}
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, Report& report, double tolerance,
+          Method method, const Thresholds& thresholds) {
+  Solver solver;
+  int result = -1;
+  if (solver.Setup(A, tolerance, method, thresholds)) {
+    result = solver.Solve(x, b);
+  }
+  solver.report_.iterations_ = result;
+  report = solver.report_;
+  return result;
+}
+
+}  // namespace cpe::linearsolver::automatic
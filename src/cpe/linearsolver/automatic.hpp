@@ -0,0 +1,118 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpe/linearsolver/lu.hpp>
+#include <cpe/linearsolver/preconditioner.hpp>
+#include <cpe/linearsolver/skyline.hpp>
+#include <cpe/matrix/matrix.hpp>
+#include <string>
+
+namespace cpe::linearsolver::automatic {
+
+enum class Method {
+  kAutomatic,
+  kDenseDirect,   // lu
+  kSparseDirect,  // skyline
+  kKrylov,        // cg with a Jacobi preconditioner
+  kStationary,    // ssor
+};
+
+const char* GetName(Method method);
+
+// Relative difference up to which A[i, j] and A[j, i] count as equal
+constexpr double kSymmetryTolerance = 1.0e-12;
+
+struct Analysis {
+  std::size_t num_rows_ = 0;
+  std::size_t num_nonzeros_ = 0;
+  std::size_t profile_size_ = 0;
+  double density_ = 0.0;
+  bool symmetric_ = false;
+  bool diagonally_dominant_ = false;
+  // Spectral condition number of D^-1 A from a few Lanczos steps; zero when
+  // the matrix is not symmetric.
+  double condition_estimate_ = 0.0;
+};
+
+struct Thresholds {
+  // Systems up to this size, or at least this dense, are factored densely
+  std::size_t dense_rows_ = 100;
+  double dense_density_ = 0.25;
+  // Larger systems are factored within their profile up to this size...
+  std::size_t sparse_rows_ = 2000;
+  // ...and beyond it only if they look hard for Krylov and the profile fits
+  double ill_conditioned_ = 1.0e8;
+  std::size_t profile_size_ = 50000000;
+};
+
+struct Report {
+  Analysis analysis_;
+  Method method_ = Method::kAutomatic;
+  std::string rationale_;
+  int iterations_ = 0;
+};
+
+Analysis Analyze(const cpe::matrix::Matrix& A);
+
+// Picks a method for the analysed matrix, filling method_ and rationale_
+Report Select(const Analysis& analysis,
+              const Thresholds& thresholds = Thresholds());
+
+// What Solve sets up for one matrix, the factorization of a direct method or
+// the preconditioner of cg, kept to solve for many right hand sides.  The
+// matrix must stay alive and unchanged until Reset or the next Setup.
+class Solver {
+ public:
+  // Selects a method as Solve does, or takes method when one is given, and
+  // factors A for it, falling back as Solve does.  Returns false if no
+  // method could be set up.
+  bool Setup(const cpe::matrix::Matrix& A, double tolerance = 1.0e-10,
+             Method method = Method::kAutomatic,
+             const Thresholds& thresholds = Thresholds());
+  bool IsSetup() const { return A_ != nullptr; }
+  void Reset();
+  // Solves A x = b, starting an iterative method from x.  Returns the number
+  // of iterations (1 for direct methods), or -1.
+  int Solve(cpe::matrix::Matrix& x, const cpe::matrix::Matrix& b);
+
+  Report report_;
+
+ private:
+  bool Factor();
+
+  const cpe::matrix::Matrix* A_ = nullptr;
+  preconditioner::Preconditioner jacobi_;
+  lu::Factorization<double> lu_;
+  skyline::Factorization skyline_;
+  double tolerance_ = 1.0e-10;
+};
+
+// Solves with the selected method, or with method when one is given, falling
+// back to a direct method if it fails.  Returns the number of iterations (1
+// for direct methods), or -1.
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, Report& report,
+          double tolerance = 1.0e-10, Method method = Method::kAutomatic,
+          const Thresholds& thresholds = Thresholds());
+
+}  // namespace cpe::linearsolver::automatic
@@ -0,0 +1,186 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cpe/linearsolver/automatic.hpp>
+#include <cpe/linearsolver/lu.hpp>
+#include <cpe/linearsolver/springchain.test.hpp>
+
+namespace {
+
+using cpe::linearsolver::automatic::Method;
+using cpe::linearsolver::testing::SpringChain;
+
+TEST(AutomaticTest, Analyze) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  auto analysis = cpe::linearsolver::automatic::Analyze(A);
+  EXPECT_EQ(analysis.num_rows_, 5);
+  EXPECT_EQ(analysis.num_nonzeros_, 17);
+  EXPECT_EQ(analysis.profile_size_, 13);
+  EXPECT_DOUBLE_EQ(analysis.density_, 17.0 / 25.0);
+  EXPECT_TRUE(analysis.symmetric_);
+  EXPECT_TRUE(analysis.diagonally_dominant_);
+  EXPECT_GT(analysis.condition_estimate_, 1.0);
+  EXPECT_LT(analysis.condition_estimate_, 10.0);
+
+  // A difference in the last bit is rounding, not asymmetry
+  A[0, 1] = std::nextafter(-1.0, 0.0);
+  EXPECT_TRUE(cpe::linearsolver::automatic::Analyze(A).symmetric_);
+
+  A[0, 1] = 5.0;
+  analysis = cpe::linearsolver::automatic::Analyze(A);
+  EXPECT_FALSE(analysis.symmetric_);
+  EXPECT_FALSE(analysis.diagonally_dominant_);
+  EXPECT_EQ(analysis.condition_estimate_, 0.0);
+}
+
+TEST(AutomaticTest, Select) {
+  constexpr std::size_t n = 200;
+  auto analysis = cpe::linearsolver::automatic::Analyze(SpringChain(n, 0.5));
+  using cpe::linearsolver::automatic::Select;
+  using cpe::linearsolver::automatic::Thresholds;
+  EXPECT_EQ(Select(analysis, Thresholds{.dense_rows_ = n}).method_,
+            Method::kDenseDirect);
+  EXPECT_EQ(Select(analysis, Thresholds{.dense_density_ = 0.01}).method_,
+            Method::kDenseDirect);
+  EXPECT_EQ(Select(analysis).method_, Method::kSparseDirect);
+  EXPECT_EQ(Select(analysis, Thresholds{.sparse_rows_ = 10}).method_,
+            Method::kKrylov);
+  EXPECT_EQ(
+      Select(analysis, Thresholds{.sparse_rows_ = 10, .ill_conditioned_ = 10.0})
+          .method_,
+      Method::kSparseDirect);
+  EXPECT_EQ(Select(analysis, Thresholds{.sparse_rows_ = 10,
+                                        .ill_conditioned_ = 10.0,
+                                        .profile_size_ = 10})
+                .method_,
+            Method::kKrylov);
+  EXPECT_FALSE(Select(analysis).rationale_.empty());
+
+  analysis.symmetric_ = false;
+  EXPECT_EQ(Select(analysis).method_, Method::kDenseDirect);
+}
+
+TEST(AutomaticTest, Solve) {
+  constexpr std::size_t n = 200;
+  cpe::matrix::Matrix A = SpringChain(n, 0.5);
+  cpe::matrix::Matrix b(n, 1);
+  b[n - 1] = 1.0;
+  cpe::matrix::Matrix x_ref(n, 1);
+  ASSERT_EQ(cpe::linearsolver::lu::Solve(A, x_ref, b), 1);
+
+  using cpe::linearsolver::automatic::Thresholds;
+  const std::vector<std::pair<Thresholds, Method> > cases = {
+      {Thresholds{.dense_rows_ = n}, Method::kDenseDirect},
+      {Thresholds(), Method::kSparseDirect},
+      {Thresholds{.sparse_rows_ = 10}, Method::kKrylov}};
+  for (const auto& [thresholds, method] : cases) {
+    cpe::linearsolver::automatic::Report report;
+    cpe::matrix::Matrix x(n, 1);
+    int result = cpe::linearsolver::automatic::Solve(
+        A, x, b, report, 1.0e-10, Method::kAutomatic, thresholds);
+    EXPECT_GT(result, 0);
+    EXPECT_EQ(report.method_, method);
+    EXPECT_EQ(report.iterations_, result);
+    for (std::size_t i = 0; i < n; ++i) EXPECT_NEAR(x[i], x_ref[i], 1.0e-6);
+  }
+
+  cpe::linearsolver::automatic::Report report;
+  cpe::matrix::Matrix x(n, 1);
+  cpe::linearsolver::automatic::Solve(A, x, b, report, 1.0e-10,
+                                      Method::kStationary);
+  EXPECT_EQ(report.method_, Method::kStationary);
+  EXPECT_EQ(report.rationale_, "requested");
+}
+
+TEST(AutomaticTest, Fallback) {
+  // Symmetric but indefinite, so cholesky fails and lu takes over
+  constexpr std::size_t n = 200;
+  cpe::matrix::Matrix A = SpringChain(n, 0.5);
+  A[0, 0] = -A[0, 0];
+  cpe::matrix::Matrix b(n, 1);
+  b[n - 1] = 1.0;
+  cpe::linearsolver::automatic::Report report;
+  cpe::matrix::Matrix x(n, 1);
+  int result = cpe::linearsolver::automatic::Solve(A, x, b, report);
+  EXPECT_EQ(result, 1);
+  EXPECT_EQ(report.method_, Method::kDenseDirect);
+  EXPECT_NE(report.rationale_.find("fell back"), std::string::npos);
+}
+
+TEST(AutomaticTest, KrylovFallback) {
+  // cg and then cholesky fail on the indefinite matrix, so lu takes over
+  constexpr std::size_t n = 200;
+  cpe::matrix::Matrix A = SpringChain(n, 0.5);
+  A[0, 0] = -A[0, 0];
+  cpe::matrix::Matrix b(n, 1);
+  b[n - 1] = 1.0;
+  cpe::matrix::Matrix x_ref(n, 1);
+  ASSERT_EQ(cpe::linearsolver::lu::Solve(A, x_ref, b), 1);
+  using cpe::linearsolver::automatic::Thresholds;
+  cpe::linearsolver::automatic::Solver solver;
+  // The profile is kept from fitting so the indefinite matrix still goes to cg
+  ASSERT_TRUE(solver.Setup(A, 1.0e-10, Method::kAutomatic,
+                           Thresholds{.sparse_rows_ = 10, .profile_size_ = 0}));
+  EXPECT_EQ(solver.report_.method_, Method::kKrylov);
+  for (std::size_t k = 0; k < 2; ++k) {
+    cpe::matrix::Matrix x(n, 1);
+    EXPECT_EQ(solver.Solve(x, b), 1);
+    for (std::size_t i = 0; i < n; ++i) EXPECT_NEAR(x[i], x_ref[i], 1.0e-6);
+  }
+  EXPECT_TRUE(solver.IsSetup());
+  EXPECT_EQ(solver.report_.method_, Method::kDenseDirect);
+  EXPECT_NE(solver.report_.rationale_.find("fell back to skyline"),
+            std::string::npos);
+  EXPECT_NE(solver.report_.rationale_.find("fell back to lu"),
+            std::string::npos);
+}
+
+TEST(AutomaticTest, Solver) {
+  // One setup, then several right hand sides against the same factorization
+  constexpr std::size_t n = 200;
+  const cpe::matrix::Matrix A = SpringChain(n, 0.5);
+  cpe::linearsolver::automatic::Solver solver;
+  EXPECT_FALSE(solver.IsSetup());
+  ASSERT_TRUE(solver.Setup(A));
+  EXPECT_EQ(solver.report_.method_, Method::kSparseDirect);
+  for (std::size_t k = 0; k < 3; ++k) {
+    cpe::matrix::Matrix b(n, 1);
+    b[n - 1 - 50 * k] = 1.0 + k;
+    cpe::matrix::Matrix x_ref(n, 1);
+    ASSERT_EQ(cpe::linearsolver::lu::Solve(A, x_ref, b), 1);
+    cpe::matrix::Matrix x(n, 1);
+    EXPECT_EQ(solver.Solve(x, b), 1);
+    for (std::size_t i = 0; i < n; ++i) EXPECT_NEAR(x[i], x_ref[i], 1.0e-8);
+  }
+  solver.Reset();
+  EXPECT_FALSE(solver.IsSetup());
+  cpe::matrix::Matrix x(n, 1);
+  EXPECT_EQ(solver.Solve(x, x), -1);
+}
+
+}  // namespace
@@ -0,0 +1,350 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <array>
+#include <cmath>
+#include <cpe/linearsolver/cg.hpp>
+#include <cpe/matrix/eigen.hpp>
+#include <iomanip>
+#include <iostream>
+
+namespace cpe::linearsolver::cg {
+
+namespace {
+
+using cpe::matrix::Matrix;
+
+// In-place Cholesky factorization of a small symmetric matrix, leaving L in
+// the lower triangle.  Returns false if the matrix is not positive definite.
+bool CholeskyFactor(Matrix& a) {
+  const std::size_t n = a.GetNumRows();
+  for (std::size_t j = 0; j < n; ++j) {
+    double d = a[j, j];
+    for (std::size_t k = 0; k < j; ++k) d -= a[j, k] * a[j, k];
+    if (d <= 0.0) return false;
+    a[j, j] = std::sqrt(d);
+    for (std::size_t i = j + 1; i < n; ++i) {
+      double s = a[i, j];
+      for (std::size_t k = 0; k < j; ++k) s -= a[i, k] * a[j, k];
+      a[i, j] = s / a[j, j];
+    }
+  }
+  return true;
+}
+
+void CholeskySolve(const Matrix& l, Matrix& y) {
+  const std::size_t n = l.GetNumRows();
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t k = 0; k < i; ++k) y[i] -= l[i, k] * y[k];
+    y[i] /= l[i, i];
+  }
+  for (std::size_t i = n; i-- > 0;) {
+    for (std::size_t k = i + 1; k < n; ++k) y[i] -= l[k, i] * y[k];
+    y[i] /= l[i, i];
+  }
+}
+
+// Replaces the recycle space with the Ritz vectors for the smallest Ritz
+// values of A over span(z).  The images az = A z are orthonormalized alongside
+// z so that no additional matrix-vector products are needed.
+void Harvest(std::vector<Matrix>& z, std::vector<Matrix>& az,
+             RecycleSpace& space) {
+  std::vector<std::size_t> kept;
+  for (std::size_t j = 0; j < z.size(); ++j) {
+    const double initial_norm = std::sqrt(cpe::matrix::Dot(z[j], z[j]));
+    for (int pass = 0; pass < 2; ++pass) {
+      for (std::size_t i : kept) {
+        const double h = cpe::matrix::Dot(z[i], z[j]);
+        for (std::size_t r = 0; r < z[j].GetNumRows(); ++r) {
+          z[j][r] -= h * z[i][r];
+          az[j][r] -= h * az[i][r];
+        }
+      }
+    }
+    const double norm = std::sqrt(cpe::matrix::Dot(z[j], z[j]));
+    if (norm <= 1.0e-8 * initial_norm || norm == 0.0) continue;
+    z[j] *= 1.0 / norm;
+    az[j] *= 1.0 / norm;
+    kept.push_back(j);
+  }
+
+  const std::size_t m = kept.size();
+  Matrix g(m, m);
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t j = 0; j <= i; ++j) {
+      g[i, j] = g[j, i] = 0.5 * (cpe::matrix::Dot(z[kept[i]], az[kept[j]]) +
+                                 cpe::matrix::Dot(z[kept[j]], az[kept[i]]));
+    }
+  }
+  Matrix values(m, 1);
+  Matrix vectors(m, m);
+  cpe::matrix::SymmetricEigen(g, values, vectors);
+
+  const std::size_t k = std::min(space.num_vectors_, m);
+  space.basis_.assign(k, Matrix(z.empty() ? 0 : z[0].GetNumRows(), 1));
+  for (std::size_t c = 0; c < k; ++c) {
+    for (std::size_t j = 0; j < m; ++j) {
+      const double y = vectors[j, c];
+      for (std::size_t r = 0; r < z[kept[j]].GetNumRows(); ++r) {
+        space.basis_[c][r] += y * z[kept[j]][r];
+      }
+    }
+  }
+}
+
+}  // namespace
+
+RecycleSpace::RecycleSpace(std::size_t num_vectors, std::size_t num_directions)
+    : num_directions_(num_directions), num_vectors_(num_vectors) {};
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, double tolerance) {
+  RecycleSpace space(0, 0);
+  return Solve(A, x, b, space, tolerance);
+}
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, RecycleSpace& space,
+          double tolerance) {
+  constexpr double min_value = 1.0e-12;
+  const std::size_t n = A.GetNumRows();
+  Matrix residual(n, 1);
+  Matrix direction(n, 1);
+  Matrix a_direction(n, 1);
+
+  // Set up the deflation space, W, along with A W and E = W^T A W
+  std::vector<Matrix>& w = space.basis_;
+  if (!w.empty() && w[0].GetNumRows() != n) space.Clear();
+  std::vector<Matrix> aw(w.size(), Matrix(n, 1));
+  for (std::size_t j = 0; j < w.size(); ++j) cpe::matrix::Multiply(A, w[j], aw[j]);
+  Matrix e(w.size(), w.size());
+  for (std::size_t i = 0; i < w.size(); ++i) {
+    for (std::size_t j = 0; j < w.size(); ++j) e[i, j] = cpe::matrix::Dot(w[i], aw[j]);
+  }
+  if (!CholeskyFactor(e)) {
+    space.Clear();
+    aw.clear();
+    e = Matrix(0, 0);
+  }
+  const std::size_t k = w.size();
+  Matrix mu(k, 1);
+
+  // Remove the components of v in span(W), i.e. v -= W E^-1 (A W)^T v
+  auto deflate = [&](Matrix& v, const Matrix& r) {
+    for (std::size_t j = 0; j < k; ++j) mu[j] = cpe::matrix::Dot(aw[j], r);
+    CholeskySolve(e, mu);
+    for (std::size_t j = 0; j < k; ++j) {
+      for (std::size_t i = 0; i < n; ++i) v[i] -= mu[j] * w[j][i];
+    }
+  };
+
+  // Start from the Galerkin projection of the error onto span(W)
+  cpe::matrix::Multiply(A, x, residual);
+  for (std::size_t i = 0; i < n; ++i) residual[i] = b[i] - residual[i];
+  if (k > 0) {
+    for (std::size_t j = 0; j < k; ++j) mu[j] = cpe::matrix::Dot(w[j], residual);
+    CholeskySolve(e, mu);
+    for (std::size_t j = 0; j < k; ++j) {
+      for (std::size_t i = 0; i < n; ++i) {
+        x[i] += mu[j] * w[j][i];
+        residual[i] -= mu[j] * aw[j][i];
+      }
+    }
+  }
+  direction = residual;
+  deflate(direction, residual);
+
+  std::vector<Matrix> z = w;
+  std::vector<Matrix> az = aw;
+  double residual_dot = cpe::matrix::Dot(residual, residual);
+  // A start that already solves the system has no direction to search
+  if (residual_dot == 0.0) return 0;
+
+  std::cout << std::setw(10) << "Iteration";
+  std::cout << std::setw(15) << "|R|";
+  std::cout << std::setw(15) << "|R| / |x|";
+  std::cout << std::setw(15) << "|dx|";
+  std::cout << std::setw(15) << "|dx| / |x|";
+  std::cout << std::endl;
+  std::cout << std::setw(10) << "---------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::endl;
+
+  constexpr int maximum_iterations = 1000;
+  int iteration_count = 0;
+  bool converged = false;
+  for (std::size_t it = 0; it < maximum_iterations; ++it) {
+    iteration_count++;
+
+    cpe::matrix::Multiply(A, direction, a_direction);
+    const double curvature = cpe::matrix::Dot(direction, a_direction);
+    if (curvature <= 0.0) break;
+    const double alpha = residual_dot / curvature;
+    if (z.size() < k + space.num_directions_) {
+      z.push_back(direction);
+      az.push_back(a_direction);
+    }
+
+    double update_absolute_error = 0.0;
+    double update_relative_error = 0.0;
+    double residual_absolute_error = 0.0;
+    double residual_relative_error = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      const double update = alpha * direction[i];
+      x[i] += update;
+      residual[i] -= alpha * a_direction[i];
+      residual_absolute_error += (residual[i] * residual[i]);
+      residual_relative_error +=
+          (residual[i] * residual[i]) / std::max(x[i] * x[i], min_value);
+      update_absolute_error += (update * update);
+      update_relative_error +=
+          (update * update) / std::max(x[i] * x[i], min_value);
+    }
+    const double beta = residual_absolute_error / residual_dot;
+    residual_dot = residual_absolute_error;
+    for (std::size_t i = 0; i < n; ++i) {
+      direction[i] = beta * direction[i] + residual[i];
+    }
+    deflate(direction, residual);
+
+    residual_absolute_error = std::sqrt(residual_absolute_error);
+    residual_relative_error = std::sqrt(residual_relative_error);
+    update_absolute_error = std::sqrt(update_absolute_error);
+    update_relative_error = std::sqrt(update_relative_error);
+
+    std::cout << std::setw(10) << iteration_count;
+    std::cout << std::setprecision(5) << std::scientific;
+    std::cout << std::setw(15) << residual_absolute_error;
+    std::cout << std::setw(15) << residual_relative_error;
+    std::cout << std::setw(15) << update_absolute_error;
+    std::cout << std::setw(15) << update_relative_error;
+    std::cout << std::endl;
+
+    converged = update_absolute_error <= tolerance;
+    if (converged) break;
+  }
+
+  if (space.num_vectors_ > 0) Harvest(z, az, space);
+
+  return converged ? iteration_count : -1;
+}
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b,
+          const cpe::linearsolver::preconditioner::Preconditioner& M,
+          double tolerance, cpe::parallel::ThreadPool* pool) {
+  constexpr double min_value = 1.0e-12;
+  const std::size_t n = A.GetNumRows();
+  cpe::parallel::ThreadPool serial(1);
+  cpe::parallel::ThreadPool& threads = pool ? *pool : serial;
+  Matrix residual(n, 1);
+  Matrix preconditioned(n, 1);
+  Matrix direction(n, 1);
+  Matrix a_direction(n, 1);
+
+  cpe::matrix::Multiply(A, x, residual, threads);
+  for (std::size_t i = 0; i < n; ++i) residual[i] = b[i] - residual[i];
+  M(residual, preconditioned);
+  direction = preconditioned;
+  double residual_dot = cpe::matrix::Dot(residual, preconditioned, threads);
+  if (residual_dot == 0.0) return 0;
+
+  std::cout << std::setw(10) << "Iteration";
+  std::cout << std::setw(15) << "|R|";
+  std::cout << std::setw(15) << "|R| / |x|";
+  std::cout << std::setw(15) << "|dx|";
+  std::cout << std::setw(15) << "|dx| / |x|";
+  std::cout << std::endl;
+  std::cout << std::setw(10) << "---------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::endl;
+
+  constexpr int maximum_iterations = 1000;
+  int iteration_count = 0;
+  bool converged = false;
+  std::vector<std::array<double, 4> > partial(threads.GetNumPartials(n));
+  for (std::size_t it = 0; it < maximum_iterations; ++it) {
+    iteration_count++;
+
+    cpe::matrix::Multiply(A, direction, a_direction, threads);
+    const double curvature = cpe::matrix::Dot(direction, a_direction, threads);
+    if (curvature <= 0.0) break;
+    const double alpha = residual_dot / curvature;
+
+    threads.ParallelReduce(
+        n, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+          std::array<double, 4> sums{0.0, 0.0, 0.0, 0.0};
+          for (std::size_t i = begin; i < end; ++i) {
+            const double update = alpha * direction[i];
+            x[i] += update;
+            residual[i] -= alpha * a_direction[i];
+            const double x2 = std::max(x[i] * x[i], min_value);
+            sums[0] += residual[i] * residual[i];
+            sums[1] += residual[i] * residual[i] / x2;
+            sums[2] += update * update;
+            sums[3] += update * update / x2;
+          }
+          partial[chunk] = sums;
+        });
+    const std::array<double, 4> sums = cpe::parallel::PairwiseSum(partial);
+    double residual_absolute_error = sums[0];
+    double residual_relative_error = sums[1];
+    double update_absolute_error = sums[2];
+    double update_relative_error = sums[3];
+
+    M(residual, preconditioned);
+    const double next_residual_dot =
+        cpe::matrix::Dot(residual, preconditioned, threads);
+    const double beta = next_residual_dot / residual_dot;
+    residual_dot = next_residual_dot;
+    threads.ParallelFor(n, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        direction[i] = preconditioned[i] + beta * direction[i];
+      }
+    });
+
+    residual_absolute_error = std::sqrt(residual_absolute_error);
+    residual_relative_error = std::sqrt(residual_relative_error);
+    update_absolute_error = std::sqrt(update_absolute_error);
+    update_relative_error = std::sqrt(update_relative_error);
+
+    std::cout << std::setw(10) << iteration_count;
+    std::cout << std::setprecision(5) << std::scientific;
+    std::cout << std::setw(15) << residual_absolute_error;
+    std::cout << std::setw(15) << residual_relative_error;
+    std::cout << std::setw(15) << update_absolute_error;
+    std::cout << std::setw(15) << update_relative_error;
+    std::cout << std::endl;
+
+    converged = update_absolute_error <= tolerance;
+    if (converged) break;
+  }
+
+  return converged ? iteration_count : -1;
+}
+
+}  // namespace cpe::linearsolver::cg
@@ -0,0 +1,61 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpe/linearsolver/preconditioner.hpp>
+#include <cpe/matrix/matrix.hpp>
+#include <cpe/parallel/threadpool.hpp>
+#include <vector>
+
+namespace cpe::linearsolver::cg {
+
+// Approximate eigenvectors of the system matrix carried from one solve to the
+// next.  Each recycled solve deflates them out of its Krylov space and then
+// refreshes them from its first num_directions search directions, keeping the
+// num_vectors vectors with the smallest Ritz values.
+class RecycleSpace {
+ public:
+  RecycleSpace(std::size_t num_vectors = 8, std::size_t num_directions = 40);
+
+  void Clear() { basis_.clear(); }
+  std::size_t GetNumVectors() const { return basis_.size(); }
+
+  std::vector<cpe::matrix::Matrix> basis_;
+  const std::size_t num_directions_;
+  const std::size_t num_vectors_;
+};
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, double tolerance = 1.0e-6);
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, RecycleSpace& space,
+          double tolerance = 1.0e-6);
+
+// Preconditioned conjugate gradient; the matrix-vector products, dot products
+// and vector updates run on pool when one is given.
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b,
+          const cpe::linearsolver::preconditioner::Preconditioner& M,
+          double tolerance, cpe::parallel::ThreadPool* pool = nullptr);
+
+}  // namespace cpe::linearsolver::cg
@@ -0,0 +1,111 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cpe/linearsolver/cg.hpp>
+#include <cpe/linearsolver/springchain.test.hpp>
+
+namespace {
+
+using cpe::linearsolver::testing::SpringChain;
+
+TEST(CGTest, Solve) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  cpe::matrix::Matrix x(5, 1);
+  int num_iter = cpe::linearsolver::cg::Solve(A, x, b, 1.0e-6);
+  EXPECT_GT(num_iter, 0);
+  EXPECT_LE(num_iter, 6);
+  EXPECT_NEAR(x[0], 25.000000, 0.0001);
+  EXPECT_NEAR(x[1], 35.714285, 0.0001);
+  EXPECT_NEAR(x[2], 42.857143, 0.0001);
+  EXPECT_NEAR(x[3], 35.714285, 0.0001);
+  EXPECT_NEAR(x[4], 25.000000, 0.0001);
+}
+
+TEST(CGTest, Fail) {
+  cpe::matrix::Matrix A(2, 2);
+  A[0, 0] = 1.0;
+  A[1, 1] = -1.0;
+  cpe::matrix::Matrix b(2, 1);
+  b[0] = b[1] = 1.0;
+  cpe::matrix::Matrix x(2, 1);
+  int num_iter = cpe::linearsolver::cg::Solve(A, x, b, 1.0e-6);
+  EXPECT_EQ(num_iter, -1);
+}
+
+TEST(CGTest, Recycle) {
+  constexpr std::size_t n = 120;
+  constexpr std::size_t num_solves = 5;
+  cpe::linearsolver::cg::RecycleSpace space(10, 60);
+  std::vector<int> iterations;
+  for (std::size_t s = 0; s < num_solves; ++s) {
+    const double perturbation = 0.5 + 0.01 * static_cast<double>(s);
+    cpe::matrix::Matrix A = SpringChain(n, perturbation);
+    cpe::matrix::Matrix b(n, 1);
+    for (std::size_t i = 0; i < n; ++i) {
+      b[i] = std::cos(static_cast<double>(i + s));
+    }
+    cpe::matrix::Matrix x(n, 1);
+    int num_iter = cpe::linearsolver::cg::Solve(A, x, b, space, 1.0e-8);
+    ASSERT_GT(num_iter, 0);
+    iterations.push_back(num_iter);
+    EXPECT_EQ(space.GetNumVectors(), 10);
+
+    // Compare against an unrecycled solve of the same system
+    cpe::matrix::Matrix x_ref(n, 1);
+    ASSERT_GT(cpe::linearsolver::cg::Solve(A, x_ref, b, 1.0e-8), 0);
+    for (std::size_t i = 0; i < n; ++i) EXPECT_NEAR(x[i], x_ref[i], 1.0e-5);
+  }
+  for (std::size_t s = 1; s < num_solves; ++s) {
+    EXPECT_LT(iterations[s], iterations[0]);
+  }
+  EXPECT_LT(iterations.back(), 2 * iterations[0] / 3);
+}
+
+TEST(CGTest, ZeroResidual) {
+  // No load, and a start that is already the solution, need no iterations
+  constexpr std::size_t n = 20;
+  const cpe::matrix::Matrix A = SpringChain(n, 0.5);
+  const auto M = cpe::linearsolver::preconditioner::Jacobi(A);
+  cpe::linearsolver::cg::RecycleSpace space(4, 10);
+  const cpe::matrix::Matrix zero(n, 1);
+  cpe::matrix::Matrix x(n, 1);
+  EXPECT_EQ(cpe::linearsolver::cg::Solve(A, x, zero, 1.0e-8), 0);
+  EXPECT_EQ(cpe::linearsolver::cg::Solve(A, x, zero, space, 1.0e-8), 0);
+  EXPECT_EQ(cpe::linearsolver::cg::Solve(A, x, zero, M, 1.0e-8), 0);
+  for (std::size_t i = 0; i < n; ++i) EXPECT_EQ(x[i], 0.0);
+
+  cpe::matrix::Matrix b(n, 1);
+  for (std::size_t i = 0; i < n; ++i) x[i] = 1.0;
+  cpe::matrix::Multiply(A, x, b);
+  EXPECT_EQ(cpe::linearsolver::cg::Solve(A, x, b, M, 1.0e-8), 0);
+  for (std::size_t i = 0; i < n; ++i) EXPECT_EQ(x[i], 1.0);
+}
+
+}  // namespace
@@ -0,0 +1,267 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cpe/linearsolver/chebyshev.hpp>
+#include <cpe/matrix/eigen.hpp>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace cpe::linearsolver::chebyshev {
+
+namespace {
+
+using cpe::matrix::Matrix;
+
+std::vector<double> InverseDiagonal(const Matrix& A) {
+  std::vector<double> inverse_diagonal(A.GetNumRows(), 1.0);
+  for (std::size_t i = 0; i < A.GetNumRows(); ++i) {
+    if (A[i, i] != 0.0) inverse_diagonal[i] = 1.0 / A[i, i];
+  }
+  return inverse_diagonal;
+}
+
+// Three term Chebyshev recurrence on [lower, upper], scaled by D^-1
+class Recurrence {
+ public:
+  explicit Recurrence(const Bounds& bounds)
+      : theta_(0.5 * (bounds.upper_ + bounds.lower_)),
+        delta_(std::max(0.5 * (bounds.upper_ - bounds.lower_),
+                        1.0e-8 * theta_)),
+        sigma_(theta_ / delta_),
+        rho_(1.0 / sigma_) {}
+
+  // First direction d = z / theta
+  double GetInitialScale() const { return 1.0 / theta_; }
+
+  // Advances rho and returns the weights of d and z in the next direction
+  std::pair<double, double> Next() {
+    const double rho = 1.0 / (2.0 * sigma_ - rho_);
+    const std::pair<double, double> weights(rho * rho_, 2.0 * rho / delta_);
+    rho_ = rho;
+    return weights;
+  }
+
+ private:
+  const double theta_;
+  const double delta_;
+  const double sigma_;
+  double rho_;
+};
+
+}  // namespace
+
+Bounds EstimateBounds(const Matrix& A, std::size_t num_steps) {
+  const std::size_t n = A.GetNumRows();
+  num_steps = std::min(num_steps, n);
+  Bounds bounds;
+  if (num_steps == 0) return bounds;
+
+  // Lanczos on the symmetric D^-1/2 A D^-1/2, similar to D^-1 A
+  std::vector<double> scale(n, 1.0);
+  for (std::size_t i = 0; i < n; ++i) {
+    if (A[i, i] != 0.0) scale[i] = 1.0 / std::sqrt(std::fabs(A[i, i]));
+  }
+  std::vector<Matrix> basis;
+  std::vector<double> alpha;
+  std::vector<double> beta;
+  Matrix v(n, 1);
+  std::mt19937 generator(5489u);
+  for (std::size_t i = 0; i < n; ++i) {
+    v[i] = static_cast<double>(generator()) / generator.max() - 0.5;
+  }
+  v *= 1.0 / std::sqrt(cpe::matrix::Dot(v, v));
+  Matrix scaled(n, 1);
+  Matrix w(n, 1);
+  for (std::size_t k = 0; k < num_steps; ++k) {
+    basis.push_back(v);
+    for (std::size_t i = 0; i < n; ++i) scaled[i] = scale[i] * v[i];
+    cpe::matrix::Multiply(A, scaled, w);
+    for (std::size_t i = 0; i < n; ++i) w[i] *= scale[i];
+    alpha.push_back(cpe::matrix::Dot(v, w));
+    // Full reorthogonalization, the basis is small
+    for (const Matrix& q : basis) {
+      const double projection = cpe::matrix::Dot(q, w);
+      for (std::size_t i = 0; i < n; ++i) w[i] -= projection * q[i];
+    }
+    beta.push_back(std::sqrt(cpe::matrix::Dot(w, w)));
+    if (beta.back() <= 1.0e-12 * std::fabs(alpha.back())) break;
+    for (std::size_t i = 0; i < n; ++i) v[i] = w[i] / beta.back();
+  }
+
+  const std::size_t m = alpha.size();
+  Matrix T(m, m);
+  for (std::size_t k = 0; k < m; ++k) {
+    T[k, k] = alpha[k];
+    if (k + 1 < m) T[k, k + 1] = T[k + 1, k] = beta[k];
+  }
+  Matrix values(m, 1);
+  Matrix vectors(m, m);
+  cpe::matrix::SymmetricEigen(T, values, vectors);
+  const double residual = std::fabs(beta[m - 1] * vectors[m - 1, m - 1]);
+  bounds.lower_ = values[0];
+  bounds.upper_ = values[m - 1] + residual;
+  return bounds;
+}
+
+Bounds SmootherBounds(const Bounds& spectrum, double ratio) {
+  Bounds bounds;
+  bounds.lower_ = spectrum.upper_ / ratio;
+  bounds.upper_ = spectrum.upper_;
+  return bounds;
+}
+
+void Iterate(const Matrix& A, Matrix& x, const Matrix& b, const Bounds& bounds,
+             std::size_t degree, cpe::parallel::ThreadPool* pool) {
+  const std::size_t n = A.GetNumRows();
+  cpe::parallel::ThreadPool serial(1);
+  cpe::parallel::ThreadPool& threads = pool ? *pool : serial;
+  const std::vector<double> inverse_diagonal = InverseDiagonal(A);
+  Recurrence recurrence(bounds);
+  Matrix residual(n, 1);
+  Matrix direction(n, 1);
+  Matrix a_direction(n, 1);
+
+  cpe::matrix::Multiply(A, x, residual, threads);
+  const double scale = recurrence.GetInitialScale();
+  threads.ParallelFor(n, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      residual[i] = b[i] - residual[i];
+      direction[i] = scale * inverse_diagonal[i] * residual[i];
+    }
+  });
+  for (std::size_t k = 0; k < degree; ++k) {
+    cpe::matrix::Multiply(A, direction, a_direction, threads);
+    const auto [d_weight, z_weight] = recurrence.Next();
+    threads.ParallelFor(n, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        x[i] += direction[i];
+        residual[i] -= a_direction[i];
+        direction[i] = d_weight * direction[i] +
+                       z_weight * inverse_diagonal[i] * residual[i];
+      }
+    });
+  }
+}
+
+cpe::linearsolver::preconditioner::Preconditioner MakePreconditioner(
+    const Matrix& A, const Bounds& bounds, std::size_t degree,
+    cpe::parallel::ThreadPool* pool) {
+  return [&A, bounds, degree, pool](const Matrix& r, Matrix& z) {
+    for (std::size_t i = 0; i < z.GetNumRows(); ++i) z[i] = 0.0;
+    Iterate(A, z, r, bounds, degree, pool);
+  };
+}
+
+int Solve(const Matrix& A, Matrix& x, const Matrix& b, double tolerance,
+          cpe::parallel::ThreadPool* pool) {
+  constexpr double min_value = 1.0e-12;
+  const std::size_t n = A.GetNumRows();
+  const Bounds bounds = EstimateBounds(A);
+  if (!(bounds.lower_ > 0.0) || !std::isfinite(bounds.upper_)) return -1;
+
+  cpe::parallel::ThreadPool serial(1);
+  cpe::parallel::ThreadPool& threads = pool ? *pool : serial;
+  const std::vector<double> inverse_diagonal = InverseDiagonal(A);
+  Recurrence recurrence(bounds);
+  Matrix residual(n, 1);
+  Matrix direction(n, 1);
+  Matrix a_direction(n, 1);
+
+  cpe::matrix::Multiply(A, x, residual, threads);
+  const double scale = recurrence.GetInitialScale();
+  for (std::size_t i = 0; i < n; ++i) {
+    residual[i] = b[i] - residual[i];
+    direction[i] = scale * inverse_diagonal[i] * residual[i];
+  }
+
+  std::cout << std::setw(10) << "Iteration";
+  std::cout << std::setw(15) << "|R|";
+  std::cout << std::setw(15) << "|R| / |x|";
+  std::cout << std::setw(15) << "|dx|";
+  std::cout << std::setw(15) << "|dx| / |x|";
+  std::cout << std::endl;
+  std::cout << std::setw(10) << "---------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::endl;
+
+  constexpr int maximum_iterations = 1000;
+  int iteration_count = 0;
+  bool converged = false;
+  std::vector<std::array<double, 4> > partial(threads.GetNumPartials(n));
+  for (std::size_t it = 0; it < maximum_iterations; ++it) {
+    iteration_count++;
+
+    cpe::matrix::Multiply(A, direction, a_direction, threads);
+    const auto [d_weight, z_weight] = recurrence.Next();
+    // The norms only monitor convergence, the iteration itself needs none
+    threads.ParallelReduce(
+        n, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+          std::array<double, 4> sums{0.0, 0.0, 0.0, 0.0};
+          for (std::size_t i = begin; i < end; ++i) {
+            const double update = direction[i];
+            x[i] += update;
+            residual[i] -= a_direction[i];
+            direction[i] = d_weight * direction[i] +
+                           z_weight * inverse_diagonal[i] * residual[i];
+            const double x2 = std::max(x[i] * x[i], min_value);
+            sums[0] += residual[i] * residual[i];
+            sums[1] += residual[i] * residual[i] / x2;
+            sums[2] += update * update;
+            sums[3] += update * update / x2;
+          }
+          partial[chunk] = sums;
+        });
+    const std::array<double, 4> sums = cpe::parallel::PairwiseSum(partial);
+    double residual_absolute_error = sums[0];
+    double residual_relative_error = sums[1];
+    double update_absolute_error = sums[2];
+    double update_relative_error = sums[3];
+    residual_absolute_error = std::sqrt(residual_absolute_error);
+    residual_relative_error = std::sqrt(residual_relative_error);
+    update_absolute_error = std::sqrt(update_absolute_error);
+    update_relative_error = std::sqrt(update_relative_error);
+
+    std::cout << std::setw(10) << iteration_count;
+    std::cout << std::setprecision(5) << std::scientific;
+    std::cout << std::setw(15) << residual_absolute_error;
+    std::cout << std::setw(15) << residual_relative_error;
+    std::cout << std::setw(15) << update_absolute_error;
+    std::cout << std::setw(15) << update_relative_error;
+    std::cout << std::endl;
+
+    if (!std::isfinite(update_absolute_error)) break;
+    converged = update_absolute_error <= tolerance;
+    if (converged) break;
+  }
+
+  return converged ? iteration_count : -1;
+}
+
+}  // namespace cpe::linearsolver::chebyshev
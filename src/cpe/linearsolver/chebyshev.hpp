@@ -0,0 +1,63 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpe/linearsolver/preconditioner.hpp>
+#include <cpe/matrix/matrix.hpp>
+#include <cpe/parallel/threadpool.hpp>
+
+namespace cpe::linearsolver::chebyshev {
+
+// Interval containing the eigenvalues of the Jacobi scaled matrix D^-1 A
+struct Bounds {
+  double lower_ = 0.0;
+  double upper_ = 0.0;
+};
+
+// Estimates the spectrum of D^-1 A from num_steps Lanczos steps.  The lower
+// bound is the smallest Ritz value and the upper bound is the largest Ritz
+// value plus its residual, so the whole spectrum is safely covered above.
+Bounds EstimateBounds(const cpe::matrix::Matrix& A, std::size_t num_steps = 20);
+
+// Bounds targeting the upper 1 / ratio of the spectrum, for use as a smoother
+// that only needs to damp the high frequency error.
+Bounds SmootherBounds(const Bounds& spectrum, double ratio = 30.0);
+
+// Applies degree Chebyshev iterations to x.  Only matrix-vector products and
+// vector updates are needed, with no inner products.
+void Iterate(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+             const cpe::matrix::Matrix& b, const Bounds& bounds,
+             std::size_t degree, cpe::parallel::ThreadPool* pool = nullptr);
+
+// z = p(A) r for the fixed degree Chebyshev polynomial started from zero,
+// which is symmetric and so may precondition cg.  Like a smoother, it works
+// best aimed at the upper part of the spectrum with SmootherBounds.  A, and
+// pool when given, must outlive the returned preconditioner.
+cpe::linearsolver::preconditioner::Preconditioner MakePreconditioner(
+    const cpe::matrix::Matrix& A, const Bounds& bounds, std::size_t degree,
+    cpe::parallel::ThreadPool* pool = nullptr);
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, double tolerance = 1.0e-6,
+          cpe::parallel::ThreadPool* pool = nullptr);
+
+}  // namespace cpe::linearsolver::chebyshev
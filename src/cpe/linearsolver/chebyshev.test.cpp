@@ -0,0 +1,137 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cpe/linearsolver/cg.hpp>
+#include <cpe/linearsolver/chebyshev.hpp>
+#include <cpe/linearsolver/springchain.test.hpp>
+#include <cpe/matrix/eigen.hpp>
+
+namespace {
+
+cpe::matrix::Matrix Example() {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  return A;
+}
+
+using cpe::linearsolver::testing::SpringChain;
+
+TEST(ChebyshevTest, EstimateBounds) {
+  cpe::matrix::Matrix A = Example();
+  cpe::matrix::Matrix values(5, 1);
+  cpe::matrix::Matrix vectors(5, 5);
+  // The diagonal is constant, so D^-1 A is just A / 4
+  cpe::matrix::Matrix scaled = A;
+  scaled *= 0.25;
+  cpe::matrix::SymmetricEigen(scaled, values, vectors);
+  auto bounds = cpe::linearsolver::chebyshev::EstimateBounds(A);
+  EXPECT_NEAR(bounds.lower_, values[0], 1.0e-8);
+  EXPECT_NEAR(bounds.upper_, values[4], 1.0e-8);
+
+  // A few steps still bound the spectrum from above
+  cpe::matrix::Matrix B = SpringChain(100, 0.5);
+  auto estimate = cpe::linearsolver::chebyshev::EstimateBounds(B, 10);
+  EXPECT_GT(estimate.lower_, 0.0);
+  EXPECT_LT(estimate.lower_, 0.1);
+  EXPECT_GE(estimate.upper_, 2.0);
+  EXPECT_LT(estimate.upper_, 2.5);
+}
+
+TEST(ChebyshevTest, Solve) {
+  cpe::matrix::Matrix A = Example();
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  for (std::size_t num_threads : {1, 2}) {
+    cpe::parallel::ThreadPool pool(num_threads);
+    cpe::matrix::Matrix x(5, 1);
+    int num_iter = cpe::linearsolver::chebyshev::Solve(A, x, b, 1.0e-6, &pool);
+    EXPECT_GT(num_iter, 0);
+    EXPECT_LT(num_iter, 18);
+    EXPECT_NEAR(x[0], 25.000000, 0.0001);
+    EXPECT_NEAR(x[1], 35.714285, 0.0001);
+    EXPECT_NEAR(x[2], 42.857143, 0.0001);
+    EXPECT_NEAR(x[3], 35.714285, 0.0001);
+    EXPECT_NEAR(x[4], 25.000000, 0.0001);
+  }
+}
+
+TEST(ChebyshevTest, Fail) {
+  cpe::matrix::Matrix A(2, 2);
+  A[0, 0] = 1.0;
+  A[1, 1] = -1.0;
+  cpe::matrix::Matrix b(2, 1);
+  b[0] = b[1] = 1.0;
+  cpe::matrix::Matrix x(2, 1);
+  int num_iter = cpe::linearsolver::chebyshev::Solve(A, x, b, 1.0e-6);
+  EXPECT_EQ(num_iter, -1);
+}
+
+TEST(ChebyshevTest, Smoother) {
+  constexpr std::size_t n = 64;
+  cpe::matrix::Matrix A = SpringChain(n, 0.5);
+  auto bounds = cpe::linearsolver::chebyshev::SmootherBounds(
+      cpe::linearsolver::chebyshev::EstimateBounds(A));
+  // Error made of a smooth mode and an oscillatory mode of amplitude 1
+  cpe::matrix::Matrix x(n, 1);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double s = static_cast<double>(i + 1) / n;
+    x[i] = std::sin(1.5 * s) + ((i % 2) ? 1.0 : -1.0);
+  }
+  cpe::matrix::Matrix b(n, 1);
+  cpe::linearsolver::chebyshev::Iterate(A, x, b, bounds, 6);
+  // The oscillatory part is damped, the smooth part is left for a coarse grid
+  for (std::size_t i = 8; i + 8 < n; ++i) {
+    const double s = (static_cast<double>(i) + 1.5) / n;
+    EXPECT_LT(std::fabs(x[i + 1] - x[i]), 2.0 * 0.25);
+    EXPECT_NEAR(0.5 * (x[i] + x[i + 1]), std::sin(1.5 * s), 0.05);
+  }
+}
+
+TEST(ChebyshevTest, Preconditioner) {
+  constexpr std::size_t n = 200;
+  cpe::matrix::Matrix A = SpringChain(n, 0.5);
+  cpe::matrix::Matrix b(n, 1);
+  b[n - 1] = 1.0;
+  auto jacobi = cpe::linearsolver::preconditioner::Jacobi(A);
+  cpe::matrix::Matrix x_jacobi(n, 1);
+  int jacobi_iter =
+      cpe::linearsolver::cg::Solve(A, x_jacobi, b, jacobi, 1.0e-8);
+  ASSERT_GT(jacobi_iter, 0);
+
+  cpe::parallel::ThreadPool pool(2);
+  auto bounds = cpe::linearsolver::chebyshev::SmootherBounds(
+      cpe::linearsolver::chebyshev::EstimateBounds(A));
+  auto M =
+      cpe::linearsolver::chebyshev::MakePreconditioner(A, bounds, 4, &pool);
+  cpe::matrix::Matrix x(n, 1);
+  int num_iter = cpe::linearsolver::cg::Solve(A, x, b, M, 1.0e-8, &pool);
+  EXPECT_GT(num_iter, 0);
+  EXPECT_LT(num_iter, jacobi_iter / 2);
+  for (std::size_t i = 0; i < n; ++i) EXPECT_NEAR(x[i], x_jacobi[i], 1.0e-5);
+}
+
+}  // namespace
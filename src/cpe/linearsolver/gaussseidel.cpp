@@ -89,4 +89,97 @@ int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
   return converged ? iteration_count : -1;
 }
 
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, double tolerance,
+          cpe::parallel::ThreadPool& pool) {
+  constexpr double min_value = 1.0e-12;
+  const std::size_t n = A.GetNumRows();
+  const cpe::linearsolver::triangular::Schedule schedule(
+      A, cpe::linearsolver::triangular::Triangle::kLower);
+  cpe::matrix::Matrix x_old(n, 1);
+
+  std::cout << std::setw(10) << "Iteration";
+  std::cout << std::setw(15) << "|R|";
+  std::cout << std::setw(15) << "|R| / |x|";
+  std::cout << std::setw(15) << "|dx|";
+  std::cout << std::setw(15) << "|dx| / |x|";
+  std::cout << std::endl;
+  std::cout << std::setw(10) << "---------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::endl;
+
+  constexpr int maximum_iterations = 1000;
+  int iteration_count = 0;
+  bool converged = false;
+  for (std::size_t it = 0; it < maximum_iterations; ++it) {
+    iteration_count++;
+
+    x_old = x;
+    Sweep(A, x, b, schedule, pool);
+
+    // As in the serial sweep, each row's residual is A_ii times its update
+    double update_absolute_error = 0.0;
+    double update_relative_error = 0.0;
+    double residual_absolute_error = 0.0;
+    double residual_relative_error = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      const double update = x[i] - x_old[i];
+      const double residual = A[i, i] * update;
+      residual_absolute_error += (residual * residual);
+      residual_relative_error +=
+          (residual * residual) / std::max(x[i] * x[i], min_value);
+      update_absolute_error += (update * update);
+      update_relative_error +=
+          (update * update) / std::max(x[i] * x[i], min_value);
+    }
+    residual_absolute_error = std::sqrt(residual_absolute_error);
+    residual_relative_error = std::sqrt(residual_relative_error);
+    update_absolute_error = std::sqrt(update_absolute_error);
+    update_relative_error = std::sqrt(update_relative_error);
+
+    std::cout << std::setw(10) << iteration_count;
+    std::cout << std::setprecision(5) << std::scientific;
+    std::cout << std::setw(15) << residual_absolute_error;
+    std::cout << std::setw(15) << residual_relative_error;
+    std::cout << std::setw(15) << update_absolute_error;
+    std::cout << std::setw(15) << update_relative_error;
+    std::cout << std::endl;
+
+    converged = update_absolute_error <= tolerance;
+    if (converged) break;
+  }
+
+  return converged ? iteration_count : -1;
+}
+
+void Sweep(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+           const cpe::matrix::Matrix& b) {
+  for (std::size_t i = 0; i < A.GetNumRows(); ++i) {
+    double residual = b[i];
+    for (std::size_t j = 0; j < A.GetNumRows(); ++j) {
+      residual -= A[i, j] * x[j];
+    }
+    x[i] += residual / A[i, i];
+  }
+}
+
+void Sweep(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+           const cpe::matrix::Matrix& b,
+           const cpe::linearsolver::triangular::Schedule& schedule,
+           cpe::parallel::ThreadPool& pool) {
+  // (D + L) x = b - U x
+  const std::size_t n = A.GetNumRows();
+  cpe::matrix::Matrix rhs(n, 1);
+  pool.ParallelFor(n, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      rhs[i] = b[i];
+      for (std::size_t j = i + 1; j < n; ++j) rhs[i] -= A[i, j] * x[j];
+    }
+  });
+  cpe::linearsolver::triangular::Solve(schedule, A, x, rhs, pool);
+}
+
 }  // namespace cpe::linearsolver::gaussseidel
@@ -21,7 +21,9 @@
 // SOFTWARE.
 #pragma once
 
+#include <cpe/linearsolver/triangular.hpp>
 #include <cpe/matrix/matrix.hpp>
+#include <cpe/parallel/threadpool.hpp>
 #include <vector>
 
 namespace cpe::linearsolver::gaussseidel {
@@ -29,4 +31,21 @@ namespace cpe::linearsolver::gaussseidel {
 int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
           const cpe::matrix::Matrix& b, double tolerance = 1.0e-6);
 
+// Level-scheduled Gauss-Seidel, with the forward substitution of each sweep
+// spread over pool
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, double tolerance,
+          cpe::parallel::ThreadPool& pool);
+
+// A single Gauss-Seidel sweep, updating x in place
+void Sweep(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+           const cpe::matrix::Matrix& b);
+
+// A single sweep as a level-scheduled lower triangular solve, where schedule
+// is the Triangle::kLower schedule of A
+void Sweep(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+           const cpe::matrix::Matrix& b,
+           const cpe::linearsolver::triangular::Schedule& schedule,
+           cpe::parallel::ThreadPool& pool);
+
 }  // namespace cpe::linearsolver::gaussseidel
@@ -56,4 +56,63 @@ TEST(GaussSeidelTest, Fail) {
   EXPECT_EQ(num_iter, -1);
 }
 
+TEST(GaussSeidelTest, Sweep) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  cpe::matrix::Matrix x(5, 1);
+  cpe::linearsolver::gaussseidel::Sweep(A, x, b);
+  EXPECT_DOUBLE_EQ(x[0], 25.0);
+  EXPECT_DOUBLE_EQ(x[1], 31.25);
+  EXPECT_DOUBLE_EQ(x[2], 32.8125);
+  EXPECT_DOUBLE_EQ(x[3], 26.953125);
+  EXPECT_DOUBLE_EQ(x[4], 23.92578125);
+}
+
+TEST(GaussSeidelTest, SolveThreaded) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  for (std::size_t num_threads : {1, 2}) {
+    cpe::parallel::ThreadPool pool(num_threads);
+    cpe::matrix::Matrix x(5, 1);
+    int num_iter =
+        cpe::linearsolver::gaussseidel::Solve(A, x, b, 1.0e-6, pool);
+    EXPECT_EQ(num_iter, 15);
+    EXPECT_NEAR(x[0], 25.000000, 0.0001);
+    EXPECT_NEAR(x[1], 35.714285, 0.0001);
+    EXPECT_NEAR(x[2], 42.857143, 0.0001);
+    EXPECT_NEAR(x[3], 35.714285, 0.0001);
+    EXPECT_NEAR(x[4], 25.000000, 0.0001);
+  }
+}
+
+TEST(GaussSeidelTest, SweepThreaded) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  cpe::linearsolver::triangular::Schedule schedule(
+      A, cpe::linearsolver::triangular::Triangle::kLower);
+  cpe::parallel::ThreadPool pool(2);
+  cpe::matrix::Matrix x(5, 1);
+  cpe::linearsolver::gaussseidel::Sweep(A, x, b, schedule, pool);
+  EXPECT_DOUBLE_EQ(x[0], 25.0);
+  EXPECT_DOUBLE_EQ(x[1], 31.25);
+  EXPECT_DOUBLE_EQ(x[2], 32.8125);
+  EXPECT_DOUBLE_EQ(x[3], 26.953125);
+  EXPECT_DOUBLE_EQ(x[4], 23.92578125);
+}
+
 }  // namespace
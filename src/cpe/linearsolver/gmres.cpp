@@ -0,0 +1,143 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cmath>
+#include <cpe/linearsolver/gmres.hpp>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace cpe::linearsolver::gmres {
+
+namespace {
+
+using cpe::matrix::Matrix;
+
+}  // namespace
+
+int Solve(const Matrix& A, Matrix& x, const Matrix& b,
+          const cpe::linearsolver::preconditioner::Preconditioner& M,
+          double tolerance, std::size_t restart, int maximum_iterations) {
+  const std::size_t n = A.GetNumRows();
+  const std::size_t m = std::max<std::size_t>(restart, 1);
+  const double b_norm = std::sqrt(cpe::matrix::Dot(b, b));
+  if (b_norm == 0.0) {
+    x *= 0.0;
+    return 0;
+  }
+
+  std::cout << std::setw(10) << "Iteration";
+  std::cout << std::setw(15) << "|R|";
+  std::cout << std::setw(15) << "|R| / |b|";
+  std::cout << std::endl;
+  std::cout << std::setw(10) << "---------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::endl;
+
+  std::vector<Matrix> v(m + 1, Matrix(n, 1));
+  std::vector<Matrix> z(m, Matrix(n, 1));
+  Matrix w(n, 1);
+  Matrix H(m + 1, m);
+  std::vector<double> cs(m);
+  std::vector<double> sn(m);
+  std::vector<double> g(m + 1);
+  int iteration_count = 0;
+  bool converged = false;
+  while (!converged && iteration_count < maximum_iterations) {
+    cpe::matrix::Multiply(A, x, w);
+    for (std::size_t i = 0; i < n; ++i) w[i] = b[i] - w[i];
+    const double beta = std::sqrt(cpe::matrix::Dot(w, w));
+    if (beta <= tolerance * b_norm) {
+      converged = true;
+      break;
+    }
+    v[0] = w;
+    v[0] *= 1.0 / beta;
+    std::fill(g.begin(), g.end(), 0.0);
+    g[0] = beta;
+
+    // Arnoldi with modified Gram-Schmidt, with the Hessenberg matrix reduced
+    // to triangular form by Givens rotations as it grows
+    std::size_t k = 0;
+    while (k < m && iteration_count < maximum_iterations) {
+      iteration_count++;
+      M(v[k], z[k]);
+      cpe::matrix::Multiply(A, z[k], w);
+      for (std::size_t i = 0; i <= k; ++i) {
+        H[i, k] = cpe::matrix::Dot(w, v[i]);
+        for (std::size_t l = 0; l < n; ++l) w[l] -= H[i, k] * v[i][l];
+      }
+      const double h_next = std::sqrt(cpe::matrix::Dot(w, w));
+      for (std::size_t i = 0; i < k; ++i) {
+        const double upper = H[i, k];
+        const double lower = H[i + 1, k];
+        H[i, k] = cs[i] * upper + sn[i] * lower;
+        H[i + 1, k] = -sn[i] * upper + cs[i] * lower;
+      }
+      const double diagonal = H[k, k];
+      const double radius = std::hypot(diagonal, h_next);
+      cs[k] = radius > 0.0 ? diagonal / radius : 1.0;
+      sn[k] = radius > 0.0 ? h_next / radius : 0.0;
+      H[k, k] = radius;
+      g[k + 1] = -sn[k] * g[k];
+      g[k] = cs[k] * g[k];
+      k++;
+
+      const double residual = std::abs(g[k]);
+      std::cout << std::setw(10) << iteration_count;
+      std::cout << std::setprecision(5) << std::scientific;
+      std::cout << std::setw(15) << residual;
+      std::cout << std::setw(15) << residual / b_norm;
+      std::cout << std::endl;
+
+      converged = residual <= tolerance * b_norm;
+      // A zero h_next means the Krylov space is invariant, so the solution
+      // of the least squares problem is exact
+      if (converged || h_next == 0.0) break;
+      v[k] = w;
+      v[k] *= 1.0 / h_next;
+    }
+
+    // x += Z y with H y = g
+    std::vector<double> y(k);
+    for (std::size_t i = k; i-- > 0;) {
+      double value = g[i];
+      for (std::size_t j = i + 1; j < k; ++j) value -= H[i, j] * y[j];
+      if (H[i, i] == 0.0) return -1;
+      y[i] = value / H[i, i];
+    }
+    for (std::size_t i = 0; i < k; ++i) {
+      for (std::size_t l = 0; l < n; ++l) x[l] += y[i] * z[i][l];
+    }
+    if (!std::isfinite(g[k])) break;
+  }
+
+  if (converged) {
+    // Guard against a drifting recurrence on the final restart
+    cpe::matrix::Multiply(A, x, w);
+    for (std::size_t i = 0; i < n; ++i) w[i] = b[i] - w[i];
+    converged = std::sqrt(cpe::matrix::Dot(w, w)) <= 10.0 * tolerance * b_norm;
+  }
+  return converged ? iteration_count : -1;
+}
+
+}  // namespace cpe::linearsolver::gmres
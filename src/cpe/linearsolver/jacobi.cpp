@@ -19,10 +19,15 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cpe/linearsolver/jacobi.hpp>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
 
 namespace cpe::linearsolver::jacobi {
 
@@ -91,4 +96,129 @@ int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
   return converged ? iteration_count : -1;
 }
 
+void Sweep(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+           const cpe::matrix::Matrix& b) {
+  cpe::matrix::Matrix update(A.GetNumRows(), 1);
+  for (std::size_t i = 0; i < A.GetNumRows(); ++i) {
+    double residual = b[i];
+    for (std::size_t j = 0; j < A.GetNumRows(); ++j) {
+      residual -= A[i, j] * x[j];
+    }
+    update[i] = residual / A[i, i];
+  }
+  x += update;
+}
+
+int SolveAsynchronous(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+                      const cpe::matrix::Matrix& b, double tolerance,
+                      cpe::parallel::ThreadPool& pool) {
+  constexpr double min_value = 1.0e-12;
+  const std::size_t n = A.GetNumRows();
+  const std::size_t num_blocks = pool.GetNumChunks(n);
+  const double squared_tolerance = tolerance * tolerance;
+
+  std::vector<std::atomic<double> > values(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    values[i].store(x[i], std::memory_order_relaxed);
+  }
+  std::vector<std::atomic<double> > block_update(num_blocks);
+  std::vector<int> block_sweeps(num_blocks, 0);
+
+  std::cout << std::setw(10) << "Iteration";
+  std::cout << std::setw(15) << "|R|";
+  std::cout << std::setw(15) << "|R| / |x|";
+  std::cout << std::setw(15) << "|dx|";
+  std::cout << std::setw(15) << "|dx| / |x|";
+  std::cout << std::endl;
+  std::cout << std::setw(10) << "---------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::endl;
+
+  constexpr int maximum_iterations = 1000;
+  int iteration_count = 0;
+  bool converged = false;
+  while (iteration_count < maximum_iterations) {
+    for (std::atomic<double>& update : block_update) {
+      update.store(std::numeric_limits<double>::infinity(),
+                   std::memory_order_relaxed);
+    }
+    std::atomic<bool> done = false;
+    pool.ParallelForChunks(
+        n, [&](std::size_t block, std::size_t begin, std::size_t end) {
+          while (!done.load(std::memory_order_relaxed) &&
+                 block_sweeps[block] < maximum_iterations) {
+            block_sweeps[block]++;
+            double update_error = 0.0;
+            for (std::size_t i = begin; i < end; ++i) {
+              double residual = b[i];
+              for (std::size_t j = 0; j < n; ++j) {
+                residual -= A[i, j] * values[j].load(std::memory_order_relaxed);
+              }
+              const double update = residual / A[i, i];
+              values[i].store(
+                  values[i].load(std::memory_order_relaxed) + update,
+                  std::memory_order_relaxed);
+              update_error += update * update;
+            }
+            block_update[block].store(update_error, std::memory_order_relaxed);
+
+            // Global residual monitor, built from each block's latest sweep
+            double total = 0.0;
+            for (const std::atomic<double>& u : block_update) {
+              total += u.load(std::memory_order_relaxed);
+            }
+            if (total <= squared_tolerance) {
+              done.store(true, std::memory_order_relaxed);
+            } else if (update_error <= squared_tolerance) {
+              // This block is waiting on its neighbours, let them run
+              std::this_thread::yield();
+            }
+          }
+        });
+    iteration_count =
+        *std::max_element(block_sweeps.begin(), block_sweeps.end());
+
+    // Blocks may have stopped on stale information, so confirm with a
+    // synchronous Jacobi update computed from a consistent snapshot
+    for (std::size_t i = 0; i < n; ++i) {
+      x[i] = values[i].load(std::memory_order_relaxed);
+    }
+    double update_absolute_error = 0.0;
+    double update_relative_error = 0.0;
+    double residual_absolute_error = 0.0;
+    double residual_relative_error = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      double residual = b[i];
+      for (std::size_t j = 0; j < n; ++j) residual -= A[i, j] * x[j];
+      const double update = residual / A[i, i];
+      residual_absolute_error += (residual * residual);
+      residual_relative_error +=
+          (residual * residual) / std::max(x[i] * x[i], min_value);
+      update_absolute_error += (update * update);
+      update_relative_error +=
+          (update * update) / std::max(x[i] * x[i], min_value);
+    }
+    residual_absolute_error = std::sqrt(residual_absolute_error);
+    residual_relative_error = std::sqrt(residual_relative_error);
+    update_absolute_error = std::sqrt(update_absolute_error);
+    update_relative_error = std::sqrt(update_relative_error);
+
+    std::cout << std::setw(10) << iteration_count;
+    std::cout << std::setprecision(5) << std::scientific;
+    std::cout << std::setw(15) << residual_absolute_error;
+    std::cout << std::setw(15) << residual_relative_error;
+    std::cout << std::setw(15) << update_absolute_error;
+    std::cout << std::setw(15) << update_relative_error;
+    std::cout << std::endl;
+
+    converged = update_absolute_error <= tolerance;
+    if (converged) break;
+  }
+
+  return converged ? iteration_count : -1;
+}
+
 }  // namespace cpe::linearsolver::jacobi
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <cpe/matrix/matrix.hpp>
+#include <cpe/parallel/threadpool.hpp>
 #include <vector>
 
 namespace cpe::linearsolver::jacobi {
@@ -29,4 +30,18 @@ namespace cpe::linearsolver::jacobi {
 int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
           const cpe::matrix::Matrix& b, double tolerance = 1.0e-6);
 
+// A single Jacobi sweep, updating x in place
+void Sweep(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+           const cpe::matrix::Matrix& b);
+
+// Asynchronous (chaotic) relaxation.  Each thread of pool owns a contiguous
+// block of rows and sweeps it repeatedly, reading the other blocks' latest
+// values through relaxed atomics with no barriers between sweeps.  Threads
+// stop once the sum of every block's most recent |dx|^2 meets the tolerance;
+// a synchronous check then confirms convergence or restarts the relaxation.
+// Returns the number of sweeps made by the busiest block, or -1.
+int SolveAsynchronous(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+                      const cpe::matrix::Matrix& b, double tolerance,
+                      cpe::parallel::ThreadPool& pool);
+
 }  // namespace cpe::linearsolver::jacobi
@@ -22,6 +22,7 @@
 #include <gtest/gtest.h>
 
 #include <cpe/linearsolver/jacobi.hpp>
+#include <cpe/linearsolver/lu.hpp>
 
 namespace {
 
@@ -56,4 +57,80 @@ TEST(JacobiTest, Fail) {
   EXPECT_EQ(num_iter, -1);
 }
 
+TEST(JacobiTest, Sweep) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  cpe::matrix::Matrix x(5, 1);
+  cpe::linearsolver::jacobi::Sweep(A, x, b);
+  EXPECT_DOUBLE_EQ(x[0], 25.0);
+  EXPECT_DOUBLE_EQ(x[1], 25.0);
+  EXPECT_DOUBLE_EQ(x[2], 25.0);
+  EXPECT_DOUBLE_EQ(x[3], 25.0);
+  EXPECT_DOUBLE_EQ(x[4], 25.0);
+}
+
+TEST(JacobiTest, SolveAsynchronous) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  for (std::size_t num_threads : {1, 2, 3, 5}) {
+    cpe::parallel::ThreadPool pool(num_threads);
+    cpe::matrix::Matrix x(5, 1);
+    int num_iter =
+        cpe::linearsolver::jacobi::SolveAsynchronous(A, x, b, 1.0e-6, pool);
+    EXPECT_GT(num_iter, 0);
+    EXPECT_NEAR(x[0], 25.000000, 0.0001);
+    EXPECT_NEAR(x[1], 35.714285, 0.0001);
+    EXPECT_NEAR(x[2], 42.857143, 0.0001);
+    EXPECT_NEAR(x[3], 35.714285, 0.0001);
+    EXPECT_NEAR(x[4], 25.000000, 0.0001);
+  }
+}
+
+TEST(JacobiTest, SolveAsynchronousLarge) {
+  constexpr std::size_t n = 200;
+  cpe::matrix::Matrix A(n, n);
+  cpe::matrix::Matrix b(n, 1);
+  for (std::size_t i = 0; i < n; ++i) {
+    A[i, i] = 6.0;
+    if (i > 0) A[i, i - 1] = -1.0;
+    if (i + 1 < n) A[i, i + 1] = -1.0;
+    if (i >= 10) A[i, i - 10] = -1.0;
+    if (i + 10 < n) A[i, i + 10] = -1.0;
+    b[i] = 1.0;
+  }
+  cpe::matrix::Matrix x_ref(n, 1);
+  ASSERT_GT(cpe::linearsolver::lu::Solve(A, x_ref, b), 0);
+  cpe::parallel::ThreadPool pool(4);
+  cpe::matrix::Matrix x(n, 1);
+  int num_iter =
+      cpe::linearsolver::jacobi::SolveAsynchronous(A, x, b, 1.0e-10, pool);
+  EXPECT_GT(num_iter, 0);
+  for (std::size_t i = 0; i < n; ++i) EXPECT_NEAR(x[i], x_ref[i], 1.0e-8);
+}
+
+TEST(JacobiTest, SolveAsynchronousFail) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  cpe::matrix::Matrix x(5, 1);
+  cpe::parallel::ThreadPool pool(2);
+  int num_iter =
+      cpe::linearsolver::jacobi::SolveAsynchronous(A, x, b, 1.0e-30, pool);
+  EXPECT_EQ(num_iter, -1);
+}
+
 }  // namespace
@@ -0,0 +1,289 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <algorithm>
+#include <cmath>
+#include <cpe/linearsolver/lanczos.hpp>
+#include <cpe/linearsolver/lu.hpp>
+#include <cpe/linearsolver/skyline.hpp>
+#include <cpe/matrix/eigen.hpp>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace cpe::linearsolver::lanczos {
+
+namespace {
+
+using cpe::matrix::Matrix;
+
+constexpr std::size_t kMaximumRestarts = 100;
+
+// Applies (K - shift M)^-1 M through a single factorization: an envelope
+// Cholesky when K - shift M is positive definite, as it is for a shift below
+// the spectrum, and a dense LU otherwise.
+class ShiftInvert {
+ public:
+  ShiftInvert(const Matrix& K, const Matrix& M, double shift) : M_(M) {
+    Matrix A = K;
+    if (shift != 0.0) {
+      for (std::size_t i = 0; i < A.GetNumRows(); ++i) {
+        for (std::size_t j = 0; j < A.GetNumColumns(); ++j) {
+          A[i, j] -= shift * M[i, j];
+        }
+      }
+    }
+    cholesky_ = skyline_.Factor(A);
+    if (!cholesky_ && !lu_.Factor(A)) {
+      throw std::runtime_error("K - shift M is singular, change the shift.");
+    }
+  }
+
+  std::size_t GetNumSolves() const { return num_solves_; }
+
+  // x = (K - shift M)^-1 M v
+  void Apply(const Matrix& v, Matrix& x) {
+    cpe::matrix::Multiply(M_, v, x);
+    if (cholesky_) {
+      skyline_.Solve(x);
+    } else {
+      lu_.Solve(x);
+    }
+    num_solves_++;
+  }
+
+ private:
+  bool cholesky_ = false;
+  lu::Factorization<double> lu_;
+  const Matrix& M_;
+  std::size_t num_solves_ = 0;
+  skyline::Factorization skyline_;
+};
+
+// M-orthonormal basis with the M-images of its vectors, so inner products
+// need no further products with M
+class Basis {
+ public:
+  explicit Basis(const Matrix& M) : M_(M) {}
+
+  std::size_t GetNumVectors() const { return vectors_.size(); }
+
+  // Removes the M-projection onto the basis from w, with a second pass for
+  // stability, and returns the coefficients.  Appends the normalized
+  // remainder and returns its norm in remainder unless w lay in the span of
+  // the basis.
+  std::vector<double> Append(Matrix w, double& remainder) {
+    std::vector<double> coefficients(vectors_.size(), 0.0);
+    Matrix mw(w.GetNumRows(), 1);
+    cpe::matrix::Multiply(M_, w, mw);
+    const double original = std::sqrt(std::max(cpe::matrix::Dot(w, mw), 0.0));
+    for (int pass = 0; pass < 2; ++pass) {
+      for (std::size_t i = 0; i < vectors_.size(); ++i) {
+        const double c = cpe::matrix::Dot(images_[i], w);
+        coefficients[i] += c;
+        for (std::size_t k = 0; k < w.GetNumRows(); ++k) {
+          w[k] -= c * vectors_[i][k];
+        }
+      }
+    }
+    cpe::matrix::Multiply(M_, w, mw);
+    remainder = std::sqrt(std::max(cpe::matrix::Dot(w, mw), 0.0));
+    if (!(remainder > 1.0e-10 * original)) {
+      remainder = 0.0;
+      return coefficients;
+    }
+    w *= 1.0 / remainder;
+    mw *= 1.0 / remainder;
+    vectors_.push_back(std::move(w));
+    images_.push_back(std::move(mw));
+    return coefficients;
+  }
+
+  // Replaces the basis by the combinations vectors * S[:, columns] followed
+  // by its vectors from first on
+  void Restart(const Matrix& S, const std::vector<std::size_t>& columns,
+               std::size_t first) {
+    const std::size_t n = M_.GetNumRows();
+    std::vector<Matrix> vectors;
+    std::vector<Matrix> images;
+    for (std::size_t q : columns) {
+      Matrix y(n, 1);
+      Matrix my(n, 1);
+      for (std::size_t c = 0; c < S.GetNumRows(); ++c) {
+        const double s = S[c, q];
+        for (std::size_t k = 0; k < n; ++k) {
+          y[k] += s * vectors_[c][k];
+          my[k] += s * images_[c][k];
+        }
+      }
+      vectors.push_back(std::move(y));
+      images.push_back(std::move(my));
+    }
+    for (std::size_t c = first; c < vectors_.size(); ++c) {
+      vectors.push_back(std::move(vectors_[c]));
+      images.push_back(std::move(images_[c]));
+    }
+    vectors_ = std::move(vectors);
+    images_ = std::move(images);
+  }
+
+  std::vector<Matrix> images_;
+  const Matrix& M_;
+  std::vector<Matrix> vectors_;
+};
+
+}  // namespace
+
+int Solve(const Matrix& K, const Matrix& M, std::size_t num_modes,
+          Matrix& values, Matrix& vectors, double shift, double tolerance,
+          std::size_t block_size) {
+  const std::size_t n = K.GetNumRows();
+  const std::size_t p = std::max<std::size_t>(block_size, 1);
+  if (num_modes == 0 || num_modes > n) return -1;
+  // Room for the wanted modes, as many again to speed convergence, and the
+  // block still to be expanded
+  const std::size_t max_vectors =
+      std::min(n, std::max(2 * num_modes, num_modes + 2 * p) + p);
+
+  ShiftInvert op(K, M, shift);
+  Basis basis(M);
+  std::mt19937 generator(5489u);
+  Matrix w(n, 1);
+  // Adds the image of a random vector, which lies in the range of the
+  // operator like every other basis vector
+  auto append_random = [&]() {
+    Matrix r(n, 1);
+    for (std::size_t i = 0; i < n; ++i) {
+      r[i] = static_cast<double>(generator()) / generator.max() - 0.5;
+    }
+    op.Apply(r, w);
+    double remainder = 0.0;
+    basis.Append(w, remainder);
+    return remainder > 0.0;
+  };
+  for (std::size_t j = 0; j < p; ++j) append_random();
+
+  // T[i, c] = <v_i, Op v_c>_M as found while expanding column c.  Its upper
+  // triangle is the projection of the operator on the expanded basis and the
+  // rows of the unexpanded block couple the residuals to the basis.
+  Matrix T(max_vectors + p, max_vectors + p);
+  std::size_t num_expanded = 0;
+  for (std::size_t restart = 0; restart <= kMaximumRestarts; ++restart) {
+    // Once the basis spans the range of the operator it stops growing, and
+    // expanding the rest of it makes the Ritz pairs exact
+    bool exhausted = false;
+    while (num_expanded < basis.GetNumVectors() &&
+           (basis.GetNumVectors() < max_vectors || exhausted ||
+            num_expanded < num_modes)) {
+      const std::size_t end = basis.GetNumVectors();
+      for (std::size_t c = num_expanded; c < end; ++c) {
+        op.Apply(basis.vectors_[c], w);
+        double remainder = 0.0;
+        const std::vector<double> h = basis.Append(w, remainder);
+        for (std::size_t i = 0; i < h.size(); ++i) T[i, c] = h[i];
+        if (remainder > 0.0) {
+          T[h.size(), c] = remainder;
+        } else if (!exhausted) {
+          // Deflate the block and keep its width with a fresh direction
+          exhausted = !append_random();
+        }
+      }
+      num_expanded = end;
+    }
+    const std::size_t m = num_expanded;
+    if (m < num_modes) return -1;
+
+    // Rayleigh-Ritz on the expanded basis
+    Matrix H(m, m);
+    for (std::size_t i = 0; i < m; ++i) {
+      for (std::size_t j = i; j < m; ++j) H[i, j] = H[j, i] = T[i, j];
+    }
+    Matrix theta(m, 1);
+    Matrix S(m, m);
+    cpe::matrix::SymmetricEigen(H, theta, S);
+    std::vector<std::size_t> order(m);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+      return std::abs(theta[a]) > std::abs(theta[b]);
+    });
+
+    // Coupling of each Ritz vector to the unexpanded block, whose norm is the
+    // M-norm of its residual
+    const std::size_t num_unexpanded = basis.GetNumVectors() - m;
+    Matrix coupling(num_unexpanded, m);
+    bool converged = true;
+    for (std::size_t q = 0; q < m; ++q) {
+      double residual = 0.0;
+      for (std::size_t u = 0; u < num_unexpanded; ++u) {
+        double value = 0.0;
+        for (std::size_t c = 0; c < m; ++c) value += T[m + u, c] * S[c, q];
+        coupling[u, q] = value;
+        residual += value * value;
+      }
+      const bool wanted =
+          std::find(order.begin(), order.begin() + num_modes, q) !=
+          order.begin() + num_modes;
+      if (wanted && std::sqrt(residual) > tolerance * std::abs(theta[q])) {
+        converged = false;
+      }
+    }
+
+    if (converged || restart == kMaximumRestarts) {
+      if (!converged) return -1;
+      std::vector<std::size_t> wanted(order.begin(),
+                                      order.begin() + num_modes);
+      std::sort(wanted.begin(), wanted.end(),
+                [&](std::size_t a, std::size_t b) {
+                  return 1.0 / theta[a] < 1.0 / theta[b];
+                });
+      basis.Restart(S, wanted, basis.GetNumVectors());
+      values = Matrix(num_modes, 1);
+      vectors = Matrix(n, num_modes);
+      for (std::size_t q = 0; q < num_modes; ++q) {
+        values[q] = shift + 1.0 / theta[wanted[q]];
+        for (std::size_t k = 0; k < n; ++k) {
+          vectors[k, q] = basis.vectors_[q][k];
+        }
+      }
+      return static_cast<int>(op.GetNumSolves());
+    }
+
+    // Thick restart: keep the best Ritz vectors, with the projection reduced
+    // to their Ritz values and their coupling to the unexpanded block
+    const std::size_t extra =
+        max_vectors > num_modes + p ? (max_vectors - num_modes - p) / 2 : 0;
+    const std::size_t num_kept = std::min(m - 1, num_modes + extra);
+    std::vector<std::size_t> kept(order.begin(), order.begin() + num_kept);
+    basis.Restart(S, kept, m);
+    T = Matrix(max_vectors + p, max_vectors + p);
+    for (std::size_t i = 0; i < num_kept; ++i) {
+      T[i, i] = theta[kept[i]];
+      for (std::size_t u = 0; u < num_unexpanded; ++u) {
+        T[i, num_kept + u] = T[num_kept + u, i] = coupling[u, kept[i]];
+      }
+    }
+    num_expanded = num_kept;
+  }
+  return -1;
+}
+
+}  // namespace cpe::linearsolver::lanczos
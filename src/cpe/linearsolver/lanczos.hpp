@@ -0,0 +1,42 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpe/matrix/matrix.hpp>
+
+namespace cpe::linearsolver::lanczos {
+
+// Finds the num_modes eigenpairs of K x = lambda M x nearest to shift, for a
+// symmetric K and a symmetric positive semi-definite M, by shift-invert block
+// Lanczos with thick restarts.  K - shift M is factored once, so each Lanczos
+// step costs one solve per block vector, and the basis is kept M-orthonormal
+// by full reorthogonalization.  Blocks wider than the multiplicity of the
+// wanted eigenvalues are needed to find every copy of a repeated eigenvalue.
+// Eigenvalues are returned in ascending order in the column vector values and
+// the matching M-normalized eigenvectors are the columns of vectors.  Returns
+// the number of solves, or -1 if the eigenpairs did not converge.
+int Solve(const cpe::matrix::Matrix& K, const cpe::matrix::Matrix& M,
+          std::size_t num_modes, cpe::matrix::Matrix& values,
+          cpe::matrix::Matrix& vectors, double shift = 0.0,
+          double tolerance = 1.0e-8, std::size_t block_size = 2);
+
+}  // namespace cpe::linearsolver::lanczos
@@ -0,0 +1,197 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cpe/linearsolver/lanczos.hpp>
+#include <cpe/linearsolver/springchain.test.hpp>
+#include <cpe/matrix/eigen.hpp>
+#include <numbers>
+
+namespace {
+
+using cpe::linearsolver::testing::SpringChain;
+
+// Eigenvalue j of SpringChain(n) with unit masses,
+// 4 sin^2((2 j - 1) pi / (2 (2 n + 1))) for j = 1 .. n
+double ChainEigenvalue(std::size_t n, std::size_t j) {
+  const double s = std::sin(static_cast<double>(2 * j - 1) * std::numbers::pi /
+                            static_cast<double>(2 * (2 * n + 1)));
+  return 4.0 * s * s;
+}
+
+cpe::matrix::Matrix Identity(std::size_t n) {
+  cpe::matrix::Matrix M(n, n);
+  for (std::size_t i = 0; i < n; ++i) M[i, i] = 1.0;
+  return M;
+}
+
+// Largest |K x - lambda M x| over the modes, and largest |x^T M x - 1|
+void CheckModes(const cpe::matrix::Matrix& K, const cpe::matrix::Matrix& M,
+                const cpe::matrix::Matrix& values,
+                const cpe::matrix::Matrix& vectors, double tolerance) {
+  const std::size_t n = K.GetNumRows();
+  for (std::size_t q = 0; q < values.GetNumRows(); ++q) {
+    cpe::matrix::Matrix x(n, 1);
+    for (std::size_t i = 0; i < n; ++i) x[i] = vectors[i, q];
+    cpe::matrix::Matrix kx(n, 1);
+    cpe::matrix::Matrix mx(n, 1);
+    cpe::matrix::Multiply(K, x, kx);
+    cpe::matrix::Multiply(M, x, mx);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(kx[i], values[q] * mx[i], tolerance);
+    }
+    EXPECT_NEAR(cpe::matrix::Dot(x, mx), 1.0, tolerance);
+  }
+}
+
+TEST(LanczosTest, SpringChain) {
+  constexpr std::size_t n = 300;
+  constexpr std::size_t num_modes = 6;
+  const cpe::matrix::Matrix K = SpringChain(n);
+  const cpe::matrix::Matrix M = Identity(n);
+  cpe::matrix::Matrix values(1, 1);
+  cpe::matrix::Matrix vectors(1, 1);
+  const int num_solves =
+      cpe::linearsolver::lanczos::Solve(K, M, num_modes, values, vectors);
+  ASSERT_GT(num_solves, 0);
+  EXPECT_LE(num_solves, 10 * num_modes);
+  ASSERT_EQ(values.GetNumRows(), num_modes);
+  ASSERT_EQ(vectors.GetNumColumns(), num_modes);
+  for (std::size_t q = 0; q < num_modes; ++q) {
+    EXPECT_NEAR(values[q], ChainEigenvalue(n, q + 1), 1.0e-10);
+  }
+  CheckModes(K, M, values, vectors, 1.0e-6);
+}
+
+TEST(LanczosTest, Repeated) {
+  // Two identical, uncoupled chains have every eigenvalue twice
+  constexpr std::size_t n = 50;
+  const cpe::matrix::Matrix chain = SpringChain(n);
+  cpe::matrix::Matrix K(2 * n, 2 * n);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      const double value = chain[i, j];
+      K[i, j] = K[n + i, n + j] = value;
+    }
+  }
+  const cpe::matrix::Matrix M = Identity(2 * n);
+  cpe::matrix::Matrix values(1, 1);
+  cpe::matrix::Matrix vectors(1, 1);
+  ASSERT_GT(cpe::linearsolver::lanczos::Solve(K, M, 4, values, vectors), 0);
+  EXPECT_NEAR(values[0], ChainEigenvalue(n, 1), 1.0e-10);
+  EXPECT_NEAR(values[1], ChainEigenvalue(n, 1), 1.0e-10);
+  EXPECT_NEAR(values[2], ChainEigenvalue(n, 2), 1.0e-10);
+  EXPECT_NEAR(values[3], ChainEigenvalue(n, 2), 1.0e-10);
+  CheckModes(K, M, values, vectors, 1.0e-6);
+}
+
+TEST(LanczosTest, Generalized) {
+  // A consistent-like tridiagonal mass with a zero-mass, fixed last entry,
+  // compared against the dense decomposition of L^-1 K L^-T with M = L L^T
+  constexpr std::size_t n = 40;
+  cpe::matrix::Matrix K = SpringChain(n);
+  cpe::matrix::Matrix M(n, n);
+  for (std::size_t i = 0; i + 1 < n; ++i) {
+    M[i, i] = 2.0 + std::sin(static_cast<double>(i));
+    if (i > 0) M[i - 1, i] = M[i, i - 1] = 0.5;
+  }
+  for (std::size_t i = 0; i < n; ++i) K[n - 1, i] = K[i, n - 1] = 0.0;
+  K[n - 1, n - 1] = 1.0;
+
+  cpe::matrix::Matrix values(1, 1);
+  cpe::matrix::Matrix vectors(1, 1);
+  ASSERT_GT(cpe::linearsolver::lanczos::Solve(K, M, 5, values, vectors), 0);
+  CheckModes(K, M, values, vectors, 1.0e-6);
+  for (std::size_t q = 0; q < 5; ++q) {
+    const double fixed = vectors[n - 1, q];
+    EXPECT_EQ(fixed, 0.0);
+  }
+
+  // Reference: Cholesky of the leading block of M
+  constexpr std::size_t m = n - 1;
+  cpe::matrix::Matrix L(m, m);
+  for (std::size_t j = 0; j < m; ++j) {
+    double d = M[j, j];
+    for (std::size_t k = 0; k < j; ++k) d -= L[j, k] * L[j, k];
+    L[j, j] = std::sqrt(d);
+    for (std::size_t i = j + 1; i < m; ++i) {
+      double v = M[i, j];
+      for (std::size_t k = 0; k < j; ++k) v -= L[i, k] * L[j, k];
+      L[i, j] = v / L[j, j];
+    }
+  }
+  // C = L^-1 K L^-T, by forward substitution on the columns and then rows
+  cpe::matrix::Matrix C(m, m);
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t j = 0; j < m; ++j) C[i, j] = K[i, j];
+  }
+  for (int pass = 0; pass < 2; ++pass) {
+    for (std::size_t j = 0; j < m; ++j) {
+      for (std::size_t i = 0; i < m; ++i) {
+        double v = C[i, j];
+        for (std::size_t k = 0; k < i; ++k) v -= L[i, k] * C[k, j];
+        C[i, j] = v / L[i, i];
+      }
+    }
+    C = C.Transpose();
+  }
+  cpe::matrix::Matrix reference(m, 1);
+  cpe::matrix::Matrix reference_vectors(m, m);
+  cpe::matrix::SymmetricEigen(C, reference, reference_vectors);
+  for (std::size_t q = 0; q < 5; ++q) {
+    EXPECT_NEAR(values[q], reference[q], 1.0e-9);
+  }
+}
+
+TEST(LanczosTest, Shift) {
+  // A shift inside the spectrum finds the eigenvalues nearest to it
+  constexpr std::size_t n = 100;
+  const cpe::matrix::Matrix K = SpringChain(n);
+  const cpe::matrix::Matrix M = Identity(n);
+  const double shift =
+      0.5 * (ChainEigenvalue(n, 10) + ChainEigenvalue(n, 11)) + 1.0e-3;
+  cpe::matrix::Matrix values(1, 1);
+  cpe::matrix::Matrix vectors(1, 1);
+  ASSERT_GT(
+      cpe::linearsolver::lanczos::Solve(K, M, 2, values, vectors, shift), 0);
+  EXPECT_NEAR(values[0], ChainEigenvalue(n, 10), 1.0e-10);
+  EXPECT_NEAR(values[1], ChainEigenvalue(n, 11), 1.0e-10);
+  CheckModes(K, M, values, vectors, 1.0e-6);
+}
+
+TEST(LanczosTest, Small) {
+  // More modes than the Krylov space can hold without restarting
+  constexpr std::size_t n = 6;
+  const cpe::matrix::Matrix K = SpringChain(n);
+  const cpe::matrix::Matrix M = Identity(n);
+  cpe::matrix::Matrix values(1, 1);
+  cpe::matrix::Matrix vectors(1, 1);
+  ASSERT_GT(cpe::linearsolver::lanczos::Solve(K, M, n, values, vectors), 0);
+  for (std::size_t q = 0; q < n; ++q) {
+    EXPECT_NEAR(values[q], ChainEigenvalue(n, q + 1), 1.0e-10);
+  }
+  EXPECT_EQ(cpe::linearsolver::lanczos::Solve(K, M, n + 1, values, vectors),
+            -1);
+}
+
+}  // namespace
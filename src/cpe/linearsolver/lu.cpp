@@ -0,0 +1,87 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cmath>
+#include <cpe/linearsolver/lu.hpp>
+#include <utility>
+
+namespace cpe::linearsolver::lu {
+
+template <typename T>
+bool Factorization<T>::Factor(const cpe::matrix::Matrix& A) {
+  n_ = A.GetNumRows();
+  lu_.resize(n_ * n_);
+  pivots_.resize(n_);
+  for (std::size_t i = 0; i < n_ * n_; ++i) lu_[i] = static_cast<T>(A[i]);
+
+  for (std::size_t k = 0; k < n_; ++k) {
+    std::size_t pivot = k;
+    for (std::size_t i = k + 1; i < n_; ++i) {
+      if (std::abs(lu_[i * n_ + k]) > std::abs(lu_[pivot * n_ + k])) pivot = i;
+    }
+    pivots_[k] = pivot;
+    if (lu_[pivot * n_ + k] == T(0)) return false;
+    if (pivot != k) {
+      for (std::size_t j = 0; j < n_; ++j) {
+        std::swap(lu_[k * n_ + j], lu_[pivot * n_ + j]);
+      }
+    }
+    const T inverse = T(1) / lu_[k * n_ + k];
+    for (std::size_t i = k + 1; i < n_; ++i) {
+      const T l = lu_[i * n_ + k] * inverse;
+      lu_[i * n_ + k] = l;
+      if (l == T(0)) continue;
+      for (std::size_t j = k + 1; j < n_; ++j) {
+        lu_[i * n_ + j] -= l * lu_[k * n_ + j];
+      }
+    }
+  }
+  return true;
+}
+
+template <typename T>
+void Factorization<T>::Solve(cpe::matrix::Matrix& x) const {
+  std::vector<T> y(n_);
+  for (std::size_t i = 0; i < n_; ++i) y[i] = static_cast<T>(x[i]);
+  for (std::size_t k = 0; k < n_; ++k) std::swap(y[k], y[pivots_[k]]);
+  for (std::size_t i = 0; i < n_; ++i) {
+    for (std::size_t j = 0; j < i; ++j) y[i] -= lu_[i * n_ + j] * y[j];
+  }
+  for (std::size_t i = n_; i-- > 0;) {
+    for (std::size_t j = i + 1; j < n_; ++j) y[i] -= lu_[i * n_ + j] * y[j];
+    y[i] /= lu_[i * n_ + i];
+  }
+  for (std::size_t i = 0; i < n_; ++i) x[i] = static_cast<double>(y[i]);
+}
+
+template class Factorization<float>;
+template class Factorization<double>;
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b) {
+  Factorization<double> factorization;
+  if (!factorization.Factor(A)) return -1;
+  x = b;
+  factorization.Solve(x);
+  return 1;
+}
+
+}  // namespace cpe::linearsolver::lu
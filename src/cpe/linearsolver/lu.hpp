@@ -0,0 +1,53 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpe/matrix/matrix.hpp>
+#include <vector>
+
+namespace cpe::linearsolver::lu {
+
+// Dense LU factorization with partial pivoting, P A = L U, stored in the
+// working precision T (float or double).
+template <typename T>
+class Factorization {
+ public:
+  bool Factor(const cpe::matrix::Matrix& A);
+  std::size_t GetAllocatedSize() const {
+    return sizeof(T) * lu_.capacity() + sizeof(std::size_t) * pivots_.capacity();
+  }
+  std::size_t GetNumRows() const { return n_; }
+  void Solve(cpe::matrix::Matrix& x) const;
+
+ private:
+  std::size_t n_ = 0;
+  std::vector<T> lu_;
+  std::vector<std::size_t> pivots_;
+};
+
+extern template class Factorization<float>;
+extern template class Factorization<double>;
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b);
+
+}  // namespace cpe::linearsolver::lu
@@ -0,0 +1,109 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cmath>
+#include <cpe/linearsolver/lu.hpp>
+#include <cpe/linearsolver/mixedprecision.hpp>
+#include <iomanip>
+#include <iostream>
+
+namespace cpe::linearsolver::mixedprecision {
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, double tolerance) {
+  constexpr double min_value = 1.0e-12;
+  cpe::matrix::Matrix residual(A.GetNumRows(), 1);
+  cpe::matrix::Matrix update(A.GetNumRows(), 1);
+
+  cpe::linearsolver::lu::Factorization<float> factorization;
+  if (!factorization.Factor(A)) return -1;
+
+  std::cout << std::setw(10) << "Iteration";
+  std::cout << std::setw(15) << "|R|";
+  std::cout << std::setw(15) << "|R| / |x|";
+  std::cout << std::setw(15) << "|dx|";
+  std::cout << std::setw(15) << "|dx| / |x|";
+  std::cout << std::endl;
+  std::cout << std::setw(10) << "---------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::endl;
+
+  // Refinement either converges geometrically or not at all, so give up once
+  // the correction stops shrinking
+  constexpr int maximum_iterations = 1000;
+  constexpr int maximum_stalled_iterations = 3;
+  int iteration_count = 0;
+  int stalled_count = 0;
+  double previous_update_error = 0.0;
+  bool converged = false;
+  for (std::size_t it = 0; it < maximum_iterations; ++it) {
+    iteration_count++;
+
+    cpe::matrix::Multiply(A, x, residual);
+    for (std::size_t i = 0; i < A.GetNumRows(); ++i) {
+      residual[i] = b[i] - residual[i];
+    }
+    update = residual;
+    factorization.Solve(update);
+
+    double update_absolute_error = 0.0;
+    double update_relative_error = 0.0;
+    double residual_absolute_error = 0.0;
+    double residual_relative_error = 0.0;
+    for (std::size_t i = 0; i < A.GetNumRows(); ++i) {
+      x[i] = x[i] + update[i];
+      residual_absolute_error += (residual[i] * residual[i]);
+      residual_relative_error +=
+          (residual[i] * residual[i]) / std::max(x[i] * x[i], min_value);
+      update_absolute_error += (update[i] * update[i]);
+      update_relative_error +=
+          (update[i] * update[i]) / std::max(x[i] * x[i], min_value);
+    }
+    residual_absolute_error = std::sqrt(residual_absolute_error);
+    residual_relative_error = std::sqrt(residual_relative_error);
+    update_absolute_error = std::sqrt(update_absolute_error);
+    update_relative_error = std::sqrt(update_relative_error);
+
+    std::cout << std::setw(10) << iteration_count;
+    std::cout << std::setprecision(5) << std::scientific;
+    std::cout << std::setw(15) << residual_absolute_error;
+    std::cout << std::setw(15) << residual_relative_error;
+    std::cout << std::setw(15) << update_absolute_error;
+    std::cout << std::setw(15) << update_relative_error;
+    std::cout << std::endl;
+
+    converged = update_absolute_error <= tolerance;
+    if (converged) break;
+    if (it > 0 && update_absolute_error >= 0.5 * previous_update_error) {
+      if (++stalled_count >= maximum_stalled_iterations) break;
+    } else {
+      stalled_count = 0;
+    }
+    previous_update_error = update_absolute_error;
+  }
+
+  return converged ? iteration_count : -1;
+}
+
+}  // namespace cpe::linearsolver::mixedprecision
@@ -0,0 +1,109 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cpe/linearsolver/gaussseidel.hpp>
+#include <cpe/linearsolver/lu.hpp>
+#include <cpe/linearsolver/mixedprecision.hpp>
+
+namespace {
+
+TEST(MixedPrecisionTest, Solve) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  cpe::matrix::Matrix x(5, 1);
+  int num_iter = cpe::linearsolver::mixedprecision::Solve(A, x, b, 1.0e-12);
+  EXPECT_GT(num_iter, 1);
+  cpe::matrix::Matrix x_gs(5, 1);
+  ASSERT_GT(cpe::linearsolver::gaussseidel::Solve(A, x_gs, b, 1.0e-12), 0);
+  for (std::size_t i = 0; i < 5; ++i) EXPECT_NEAR(x[i], x_gs[i], 1.0e-10);
+}
+
+TEST(MixedPrecisionTest, DoublePrecisionAccuracy) {
+  // A spring chain with stiffnesses spanning two orders of magnitude; a
+  // single precision solve alone is only good to about 1e-4 here
+  constexpr std::size_t n = 50;
+  cpe::matrix::Matrix A(n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double k = std::pow(10.0, std::sin(static_cast<double>(i)));
+    A[i, i] += k;
+    if (i > 0) {
+      A[i - 1, i - 1] += k;
+      A[i - 1, i] -= k;
+      A[i, i - 1] -= k;
+    }
+  }
+  cpe::matrix::Matrix b(n, 1);
+  for (std::size_t i = 0; i < n; ++i) b[i] = std::cos(static_cast<double>(i));
+
+  cpe::matrix::Matrix x_ref(n, 1);
+  ASSERT_EQ(cpe::linearsolver::lu::Solve(A, x_ref, b), 1);
+  double scale = 0.0;
+  for (std::size_t i = 0; i < n; ++i) scale = std::max(scale, std::abs(x_ref[i]));
+
+  cpe::matrix::Matrix x_single = b;
+  cpe::linearsolver::lu::Factorization<float> single;
+  ASSERT_TRUE(single.Factor(A));
+  single.Solve(x_single);
+  double single_error = 0.0;
+  for (std::size_t i = 0; i < n; ++i) {
+    single_error = std::max(single_error, std::abs(x_single[i] - x_ref[i]));
+  }
+  EXPECT_GT(single_error, 1.0e-10 * scale);
+
+  cpe::matrix::Matrix x(n, 1);
+  int num_iter =
+      cpe::linearsolver::mixedprecision::Solve(A, x, b, 1.0e-12 * scale);
+  EXPECT_GT(num_iter, 0);
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_NEAR(x[i], x_ref[i], 1.0e-10 * scale);
+  }
+}
+
+TEST(MixedPrecisionTest, Fail) {
+  // Beyond the reach of a single precision factorization the correction stops
+  // contracting and the solve gives up
+  constexpr std::size_t n = 50;
+  cpe::matrix::Matrix A(n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double k = std::pow(10.0, 4.0 * std::sin(static_cast<double>(i)));
+    A[i, i] += k;
+    if (i > 0) {
+      A[i - 1, i - 1] += k;
+      A[i - 1, i] -= k;
+      A[i, i - 1] -= k;
+    }
+  }
+  cpe::matrix::Matrix b(n, 1);
+  for (std::size_t i = 0; i < n; ++i) b[i] = std::cos(static_cast<double>(i));
+  cpe::matrix::Matrix x(n, 1);
+  int num_iter = cpe::linearsolver::mixedprecision::Solve(A, x, b, 1.0e-6);
+  EXPECT_EQ(num_iter, -1);
+}
+
+}  // namespace
@@ -0,0 +1,168 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <array>
+#include <cmath>
+#include <cpe/linearsolver/pipecg.hpp>
+#include <exception>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace cpe::linearsolver::pipecg {
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, double tolerance) {
+  return Solve(A, x, b, cpe::linearsolver::preconditioner::Identity(),
+               tolerance);
+}
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b,
+          const cpe::linearsolver::preconditioner::Preconditioner& M,
+          double tolerance, cpe::parallel::ThreadPool* pool) {
+  using cpe::matrix::Matrix;
+  constexpr double min_value = 1.0e-12;
+  const std::size_t n = A.GetNumRows();
+  cpe::parallel::ThreadPool serial(1);
+  cpe::parallel::ThreadPool& threads = pool ? *pool : serial;
+
+  // r = b - A x, u = M^-1 r, w = A u, and the auxiliary recurrences
+  // m = M^-1 w, nv = A m, z = A q, q = M^-1 s, s = A p
+  Matrix r(n, 1), u(n, 1), w(n, 1), m(n, 1), nv(n, 1);
+  Matrix z(n, 1), q(n, 1), s(n, 1), p(n, 1);
+  cpe::matrix::Multiply(A, x, r, threads);
+  for (std::size_t i = 0; i < n; ++i) r[i] = b[i] - r[i];
+  // A start that already solves the system has no direction to search
+  if (cpe::matrix::Dot(r, r, threads) == 0.0) return 0;
+  M(r, u);
+  cpe::matrix::Multiply(A, u, w, threads);
+
+  std::cout << std::setw(10) << "Iteration";
+  std::cout << std::setw(15) << "|R|";
+  std::cout << std::setw(15) << "|R| / |x|";
+  std::cout << std::setw(15) << "|dx|";
+  std::cout << std::setw(15) << "|dx| / |x|";
+  std::cout << std::endl;
+  std::cout << std::setw(10) << "---------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::setw(15) << "-------------";
+  std::cout << std::endl;
+
+  constexpr int maximum_iterations = 1000;
+  int iteration_count = 0;
+  bool converged = false;
+  double previous_gamma = 0.0;
+  double previous_alpha = 0.0;
+  std::vector<std::array<double, 4> > partial(threads.GetNumPartials(n));
+  std::vector<std::array<double, 2> > dot_partial(threads.GetNumPartials(n));
+  for (std::size_t it = 0; it < maximum_iterations; ++it) {
+    iteration_count++;
+
+    // Queue the reduction, then overlap it with M^-1 w and A m
+    std::vector<std::future<void> > reduction = threads.ParallelReduceAsync(
+        n, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+          std::array<double, 2> sums{0.0, 0.0};
+          for (std::size_t i = begin; i < end; ++i) {
+            sums[0] += r[i] * u[i];
+            sums[1] += w[i] * u[i];
+          }
+          dot_partial[chunk] = sums;
+        });
+    // The queued ranges read r, u and w, so they finish even on error
+    std::exception_ptr error;
+    try {
+      M(w, m);
+      cpe::matrix::Multiply(A, m, nv, threads);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    for (std::future<void>& future : reduction) future.get();
+    if (error) std::rethrow_exception(error);
+    const std::array<double, 2> dots = cpe::parallel::PairwiseSum(dot_partial);
+    const double gamma = dots[0];
+    const double delta = dots[1];
+
+    double alpha = 0.0;
+    double beta = 0.0;
+    if (it == 0) {
+      alpha = gamma / delta;
+    } else {
+      beta = gamma / previous_gamma;
+      alpha = gamma / (delta - beta * gamma / previous_alpha);
+    }
+    if (!(alpha > 0.0) || !std::isfinite(alpha)) break;
+    previous_gamma = gamma;
+    previous_alpha = alpha;
+
+    threads.ParallelReduce(
+        n, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+          std::array<double, 4> sums{0.0, 0.0, 0.0, 0.0};
+          for (std::size_t i = begin; i < end; ++i) {
+            z[i] = nv[i] + beta * z[i];
+            q[i] = m[i] + beta * q[i];
+            s[i] = w[i] + beta * s[i];
+            p[i] = u[i] + beta * p[i];
+            const double update = alpha * p[i];
+            x[i] += update;
+            r[i] -= alpha * s[i];
+            u[i] -= alpha * q[i];
+            w[i] -= alpha * z[i];
+            const double x2 = std::max(x[i] * x[i], min_value);
+            sums[0] += r[i] * r[i];
+            sums[1] += r[i] * r[i] / x2;
+            sums[2] += update * update;
+            sums[3] += update * update / x2;
+          }
+          partial[chunk] = sums;
+        });
+    const std::array<double, 4> sums = cpe::parallel::PairwiseSum(partial);
+    double residual_absolute_error = sums[0];
+    double residual_relative_error = sums[1];
+    double update_absolute_error = sums[2];
+    double update_relative_error = sums[3];
+    residual_absolute_error = std::sqrt(residual_absolute_error);
+    residual_relative_error = std::sqrt(residual_relative_error);
+    update_absolute_error = std::sqrt(update_absolute_error);
+    update_relative_error = std::sqrt(update_relative_error);
+
+    std::cout << std::setw(10) << iteration_count;
+    std::cout << std::setprecision(5) << std::scientific;
+    std::cout << std::setw(15) << residual_absolute_error;
+    std::cout << std::setw(15) << residual_relative_error;
+    std::cout << std::setw(15) << update_absolute_error;
+    std::cout << std::setw(15) << update_relative_error;
+    std::cout << std::endl;
+
+    // The recurrences can break down from rounding soon after the exact
+    // solution is reached, before the update is small, so the residual the
+    // recurrences carry decides convergence
+    converged = residual_absolute_error <= tolerance;
+    if (converged) break;
+  }
+
+  return converged ? iteration_count : -1;
+}
+
+}  // namespace cpe::linearsolver::pipecg
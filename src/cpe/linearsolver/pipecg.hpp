@@ -0,0 +1,42 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpe/linearsolver/preconditioner.hpp>
+#include <cpe/matrix/matrix.hpp>
+#include <cpe/parallel/threadpool.hpp>
+
+namespace cpe::linearsolver::pipecg {
+
+// Pipelined (Ghysels-Vanroose) preconditioned conjugate gradient.  Both dot
+// products of an iteration are reduced together, and that reduction runs
+// concurrently with the preconditioner apply and matrix-vector product.
+// Unlike cg it stops on the norm of the residual, not of the update.
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b, double tolerance = 1.0e-6);
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b,
+          const cpe::linearsolver::preconditioner::Preconditioner& M,
+          double tolerance, cpe::parallel::ThreadPool* pool = nullptr);
+
+}  // namespace cpe::linearsolver::pipecg
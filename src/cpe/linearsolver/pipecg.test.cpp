@@ -0,0 +1,154 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cpe/linearsolver/cg.hpp>
+#include <cpe/linearsolver/pipecg.hpp>
+
+namespace {
+
+TEST(PipeCGTest, Solve) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  cpe::matrix::Matrix x(5, 1);
+  int num_iter = cpe::linearsolver::pipecg::Solve(A, x, b, 1.0e-6);
+  EXPECT_GT(num_iter, 0);
+  EXPECT_LE(num_iter, 6);
+  EXPECT_NEAR(x[0], 25.000000, 0.0001);
+  EXPECT_NEAR(x[1], 35.714285, 0.0001);
+  EXPECT_NEAR(x[2], 42.857143, 0.0001);
+  EXPECT_NEAR(x[3], 35.714285, 0.0001);
+  EXPECT_NEAR(x[4], 25.000000, 0.0001);
+}
+
+TEST(PipeCGTest, MatchesCG) {
+  constexpr std::size_t n = 60;
+  cpe::matrix::Matrix A(n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double k = 1.0 + 0.5 * std::sin(static_cast<double>(i));
+    A[i, i] += k;
+    if (i > 0) {
+      A[i - 1, i - 1] += k;
+      A[i - 1, i] -= k;
+      A[i, i - 1] -= k;
+    }
+  }
+  cpe::matrix::Matrix b(n, 1);
+  for (std::size_t i = 0; i < n; ++i) b[i] = std::cos(static_cast<double>(i));
+  auto M = cpe::linearsolver::preconditioner::Jacobi(A);
+
+  cpe::matrix::Matrix x_cg(n, 1);
+  int cg_iter = cpe::linearsolver::cg::Solve(A, x_cg, b, M, 1.0e-9);
+  ASSERT_GT(cg_iter, 0);
+  for (std::size_t num_threads : {1, 2, 4}) {
+    cpe::parallel::ThreadPool pool(num_threads);
+    cpe::matrix::Matrix x(n, 1);
+    int num_iter = cpe::linearsolver::pipecg::Solve(A, x, b, M, 1.0e-9, &pool);
+    EXPECT_GT(num_iter, 0);
+    EXPECT_LE(std::abs(num_iter - cg_iter), 2);
+    for (std::size_t i = 0; i < n; ++i) EXPECT_NEAR(x[i], x_cg[i], 1.0e-6);
+
+    cpe::matrix::Matrix x_threaded(n, 1);
+    EXPECT_GT(cpe::linearsolver::cg::Solve(A, x_threaded, b, M, 1.0e-9, &pool),
+              0);
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(x_threaded[i], x_cg[i], 1.0e-6);
+    }
+  }
+}
+
+TEST(PipeCGTest, Deterministic) {
+  constexpr std::size_t n = 3000;
+  cpe::matrix::Matrix A(n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    A[i, i] = 3.0 + std::sin(static_cast<double>(i));
+    if (i > 0) A[i - 1, i] = A[i, i - 1] = -1.0;
+  }
+  cpe::matrix::Matrix b(n, 1);
+  for (std::size_t i = 0; i < n; ++i) b[i] = std::cos(static_cast<double>(i));
+  auto M = cpe::linearsolver::preconditioner::Jacobi(A);
+
+  cpe::parallel::ThreadPool reference(1,
+                                      cpe::parallel::Reduction::kDeterministic);
+  cpe::matrix::Matrix x_pipe(n, 1);
+  cpe::matrix::Matrix x_cg(n, 1);
+  const int pipe_iter = cpe::linearsolver::pipecg::Solve(A, x_pipe, b, M,
+                                                         1.0e-9, &reference);
+  const int cg_iter =
+      cpe::linearsolver::cg::Solve(A, x_cg, b, M, 1.0e-9, &reference);
+  ASSERT_GT(pipe_iter, 0);
+  ASSERT_GT(cg_iter, 0);
+  for (std::size_t num_threads : {2, 3}) {
+    cpe::parallel::ThreadPool pool(num_threads,
+                                   cpe::parallel::Reduction::kDeterministic);
+    cpe::matrix::Matrix x(n, 1);
+    EXPECT_EQ(cpe::linearsolver::pipecg::Solve(A, x, b, M, 1.0e-9, &pool),
+              pipe_iter);
+    for (std::size_t i = 0; i < n; ++i) EXPECT_EQ(x[i], x_pipe[i]);
+    cpe::matrix::Matrix x_threaded(n, 1);
+    EXPECT_EQ(cpe::linearsolver::cg::Solve(A, x_threaded, b, M, 1.0e-9, &pool),
+              cg_iter);
+    for (std::size_t i = 0; i < n; ++i) EXPECT_EQ(x_threaded[i], x_cg[i]);
+  }
+}
+
+TEST(PipeCGTest, Fail) {
+  cpe::matrix::Matrix A(2, 2);
+  A[0, 0] = 1.0;
+  A[1, 1] = -1.0;
+  cpe::matrix::Matrix b(2, 1);
+  b[0] = b[1] = 1.0;
+  cpe::matrix::Matrix x(2, 1);
+  int num_iter = cpe::linearsolver::pipecg::Solve(A, x, b, 1.0e-6);
+  EXPECT_EQ(num_iter, -1);
+}
+
+TEST(PipeCGTest, ZeroResidual) {
+  // No load, and a start that is already the solution, need no iterations
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  cpe::matrix::Matrix x(5, 1);
+  EXPECT_EQ(cpe::linearsolver::pipecg::Solve(A, x, cpe::matrix::Matrix(5, 1),
+                                             1.0e-6),
+            0);
+  for (std::size_t i = 0; i < 5; ++i) EXPECT_EQ(x[i], 0.0);
+
+  cpe::matrix::Matrix b(5, 1);
+  for (std::size_t i = 0; i < 5; ++i) x[i] = 1.0 + i;
+  cpe::matrix::Multiply(A, x, b);
+  cpe::parallel::ThreadPool pool(2);
+  EXPECT_EQ(cpe::linearsolver::pipecg::Solve(
+                A, x, b, cpe::linearsolver::preconditioner::Jacobi(A), 1.0e-6,
+                &pool),
+            0);
+  for (std::size_t i = 0; i < 5; ++i) EXPECT_EQ(x[i], 1.0 + i);
+}
+
+}  // namespace
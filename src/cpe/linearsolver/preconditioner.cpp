@@ -0,0 +1,44 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpe/linearsolver/preconditioner.hpp>
+#include <vector>
+
+namespace cpe::linearsolver::preconditioner {
+
+Preconditioner Identity() {
+  return [](const cpe::matrix::Matrix& r, cpe::matrix::Matrix& z) { z = r; };
+}
+
+Preconditioner Jacobi(const cpe::matrix::Matrix& A) {
+  std::vector<double> inverse_diagonal(A.GetNumRows(), 1.0);
+  for (std::size_t i = 0; i < A.GetNumRows(); ++i) {
+    if (A[i, i] != 0.0) inverse_diagonal[i] = 1.0 / A[i, i];
+  }
+  return [inverse_diagonal](const cpe::matrix::Matrix& r,
+                            cpe::matrix::Matrix& z) {
+    for (std::size_t i = 0; i < inverse_diagonal.size(); ++i) {
+      z[i] = inverse_diagonal[i] * r[i];
+    }
+  };
+}
+
+}  // namespace cpe::linearsolver::preconditioner
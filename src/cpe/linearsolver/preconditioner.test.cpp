@@ -0,0 +1,58 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cpe/linearsolver/preconditioner.hpp>
+
+namespace {
+
+TEST(PreconditionerTest, Identity) {
+  cpe::matrix::Matrix r(3, 1);
+  r[0] = 1.0;
+  r[1] = -2.0;
+  r[2] = 3.0;
+  cpe::matrix::Matrix z(3, 1);
+  cpe::linearsolver::preconditioner::Identity()(r, z);
+  EXPECT_EQ(z[0], 1.0);
+  EXPECT_EQ(z[1], -2.0);
+  EXPECT_EQ(z[2], 3.0);
+}
+
+TEST(PreconditionerTest, Jacobi) {
+  cpe::matrix::Matrix A(3, 3);
+  A[0, 0] = 2.0;
+  A[1, 1] = 4.0;
+  A[0, 1] = A[1, 0] = 1.0;
+  cpe::matrix::Matrix r(3, 1);
+  r[0] = 1.0;
+  r[1] = -2.0;
+  r[2] = 3.0;
+  cpe::matrix::Matrix z(3, 1);
+  auto M = cpe::linearsolver::preconditioner::Jacobi(A);
+  M(r, z);
+  EXPECT_EQ(z[0], 0.5);
+  EXPECT_EQ(z[1], -0.5);
+  // Rows with no diagonal are left unscaled
+  EXPECT_EQ(z[2], 3.0);
+}
+
+}  // namespace
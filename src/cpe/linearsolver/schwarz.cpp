@@ -0,0 +1,222 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <algorithm>
+#include <cpe/linearsolver/lu.hpp>
+#include <cpe/linearsolver/schwarz.hpp>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace cpe::linearsolver::schwarz {
+
+namespace {
+
+using cpe::matrix::Matrix;
+
+constexpr std::size_t kNoColumn = std::numeric_limits<std::size_t>::max();
+
+struct Local {
+  std::vector<std::size_t> rows_;
+  lu::Factorization<double> factorization_;
+};
+
+struct State {
+  std::vector<Local> locals_;
+  // Coarse column of each row, or kNoColumn
+  std::vector<std::size_t> coarse_column_;
+  std::size_t num_coarse_ = 0;
+  lu::Factorization<double> coarse_;
+};
+
+// q = Z A_0^-1 Z^T v
+void CoarseSolve(const State& state, const Matrix& v, Matrix& q) {
+  const std::size_t n = v.GetNumRows();
+  Matrix coarse(state.num_coarse_, 1);
+  for (std::size_t i = 0; i < n; ++i) {
+    const std::size_t c = state.coarse_column_[i];
+    if (c != kNoColumn) coarse[c] += v[i];
+  }
+  state.coarse_.Solve(coarse);
+  for (std::size_t i = 0; i < n; ++i) {
+    const std::size_t c = state.coarse_column_[i];
+    q[i] = c != kNoColumn ? coarse[c] : 0.0;
+  }
+}
+
+// y = sum_i R_i^T A_i^-1 R_i v
+void LocalSolves(const State& state, cpe::parallel::ThreadPool* pool,
+                 const Matrix& v, Matrix& y) {
+  std::vector<Matrix> results;
+  results.reserve(state.locals_.size());
+  for (const Local& local : state.locals_) {
+    results.emplace_back(local.rows_.size(), 1);
+  }
+  const auto solve = [&](std::size_t begin, std::size_t end) {
+    for (std::size_t s = begin; s < end; ++s) {
+      const Local& local = state.locals_[s];
+      for (std::size_t i = 0; i < local.rows_.size(); ++i) {
+        results[s][i] = v[local.rows_[i]];
+      }
+      local.factorization_.Solve(results[s]);
+    }
+  };
+  if (pool) {
+    pool->ParallelFor(state.locals_.size(), solve);
+  } else {
+    solve(0, state.locals_.size());
+  }
+
+  // Summed in subdomain order so the result does not depend on the threads
+  for (std::size_t i = 0; i < y.GetNumRows(); ++i) y[i] = 0.0;
+  for (std::size_t s = 0; s < state.locals_.size(); ++s) {
+    const Local& local = state.locals_[s];
+    for (std::size_t i = 0; i < local.rows_.size(); ++i) {
+      y[local.rows_[i]] += results[s][i];
+    }
+  }
+}
+
+}  // namespace
+
+Subdomains Partition(const Matrix& A, std::size_t num_subdomains,
+                     std::size_t overlap) {
+  const std::size_t n = A.GetNumRows();
+  num_subdomains = std::max<std::size_t>(1, std::min(num_subdomains, n));
+  Subdomains subdomains(num_subdomains);
+  std::vector<bool> member(n);
+  for (std::size_t s = 0; s < num_subdomains; ++s) {
+    const std::size_t begin = n * s / num_subdomains;
+    const std::size_t end = n * (s + 1) / num_subdomains;
+    std::fill(member.begin(), member.end(), false);
+    std::vector<std::size_t> frontier;
+    for (std::size_t i = begin; i < end; ++i) {
+      member[i] = true;
+      frontier.push_back(i);
+    }
+    for (std::size_t layer = 0; layer < overlap; ++layer) {
+      std::vector<std::size_t> next;
+      for (std::size_t i : frontier) {
+        for (std::size_t j = 0; j < n; ++j) {
+          if (!member[j] && A[i, j] != 0.0) {
+            member[j] = true;
+            next.push_back(j);
+          }
+        }
+      }
+      frontier = std::move(next);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      if (member[i]) subdomains[s].push_back(i);
+    }
+  }
+  return subdomains;
+}
+
+cpe::linearsolver::preconditioner::Preconditioner AdditiveSchwarz(
+    const Matrix& A, const Subdomains& subdomains,
+    cpe::parallel::ThreadPool* pool, std::size_t coarse_components) {
+  const std::size_t n = A.GetNumRows();
+  auto state = std::make_shared<State>();
+  state->locals_.resize(subdomains.size());
+  const auto factor = [&](std::size_t begin, std::size_t end) {
+    for (std::size_t s = begin; s < end; ++s) {
+      Local& local = state->locals_[s];
+      local.rows_ = subdomains[s];
+      const std::size_t m = local.rows_.size();
+      Matrix A_local(m, m);
+      for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < m; ++j) {
+          A_local[i, j] = A[local.rows_[i], local.rows_[j]];
+        }
+      }
+      if (!local.factorization_.Factor(A_local)) {
+        std::stringstream ss;
+        ss << "Subdomain " << s << " has a singular matrix";
+        throw std::runtime_error(ss.str());
+      }
+    }
+  };
+  if (pool) {
+    pool->ParallelFor(subdomains.size(), factor);
+  } else {
+    factor(0, subdomains.size());
+  }
+
+  if (coarse_components > 0) {
+    // Number the non-empty (subdomain, component) columns
+    std::vector<std::size_t> owner(n, kNoColumn);
+    for (std::size_t s = 0; s < subdomains.size(); ++s) {
+      for (std::size_t i : subdomains[s]) {
+        if (owner[i] == kNoColumn) owner[i] = s;
+      }
+    }
+    std::vector<std::size_t> numbering(subdomains.size() * coarse_components,
+                                       kNoColumn);
+    state->coarse_column_.assign(n, kNoColumn);
+    for (std::size_t i = 0; i < n; ++i) {
+      if (owner[i] == kNoColumn) continue;
+      std::size_t& column =
+          numbering[owner[i] * coarse_components + i % coarse_components];
+      if (column == kNoColumn) column = state->num_coarse_++;
+      state->coarse_column_[i] = column;
+    }
+
+    // A_0 = Z^T A Z
+    Matrix A_coarse(state->num_coarse_, state->num_coarse_);
+    for (std::size_t i = 0; i < n; ++i) {
+      const std::size_t ci = state->coarse_column_[i];
+      if (ci == kNoColumn) continue;
+      for (std::size_t j = 0; j < n; ++j) {
+        const std::size_t cj = state->coarse_column_[j];
+        if (cj != kNoColumn) A_coarse[ci, cj] += A[i, j];
+      }
+    }
+    if (!state->coarse_.Factor(A_coarse)) {
+      throw std::runtime_error("The coarse matrix is singular");
+    }
+  }
+
+  return [state, pool, &A](const Matrix& r, Matrix& z) {
+    if (state->num_coarse_ == 0) {
+      LocalSolves(*state, pool, r, z);
+      return;
+    }
+    // Balanced: z = q + (I - Q A) M_local (r - A q), with q = Q r
+    const std::size_t n = r.GetNumRows();
+    cpe::parallel::ThreadPool serial(1);
+    cpe::parallel::ThreadPool& threads = pool ? *pool : serial;
+    Matrix q(n, 1);
+    Matrix work(n, 1);
+    Matrix y(n, 1);
+    CoarseSolve(*state, r, q);
+    cpe::matrix::Multiply(A, q, work, threads);
+    for (std::size_t i = 0; i < n; ++i) work[i] = r[i] - work[i];
+    LocalSolves(*state, pool, work, y);
+    cpe::matrix::Multiply(A, y, work, threads);
+    CoarseSolve(*state, work, z);
+    for (std::size_t i = 0; i < n; ++i) z[i] = q[i] + y[i] - z[i];
+  };
+}
+
+}  // namespace cpe::linearsolver::schwarz
@@ -0,0 +1,55 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpe/linearsolver/preconditioner.hpp>
+#include <cpe/matrix/matrix.hpp>
+#include <cpe/parallel/threadpool.hpp>
+#include <vector>
+
+namespace cpe::linearsolver::schwarz {
+
+// Sorted global rows of each subdomain
+using Subdomains = std::vector<std::vector<std::size_t> >;
+
+// Splits the rows of A into num_subdomains contiguous blocks, which follow
+// the mesh when the dofs are numbered node by node, then grows each block by
+// overlap layers of neighbours in the graph of A.
+Subdomains Partition(const cpe::matrix::Matrix& A, std::size_t num_subdomains,
+                     std::size_t overlap = 1);
+
+// Overlapping additive Schwarz, z = sum_i R_i^T A_i^-1 R_i r, with each
+// subdomain matrix A_i factored once and the local solves run concurrently
+// on pool.  With coarse_components > 0 a coarse space is added, with one
+// indicator vector per subdomain and dof component (row % coarse_components)
+// over the rows the subdomain owns, a row being owned by the first subdomain
+// that contains it.  The coarse correction is applied in balanced form,
+// z = q + (I - Q A) M (r - A q) with q = Q r, which unlike adding Q r to the
+// local solves does not raise the largest eigenvalue.  Throws
+// std::runtime_error if a subdomain or the coarse matrix is singular.  A, and
+// pool when given, must outlive the returned preconditioner.
+cpe::linearsolver::preconditioner::Preconditioner AdditiveSchwarz(
+    const cpe::matrix::Matrix& A, const Subdomains& subdomains,
+    cpe::parallel::ThreadPool* pool = nullptr,
+    std::size_t coarse_components = 0);
+
+}  // namespace cpe::linearsolver::schwarz
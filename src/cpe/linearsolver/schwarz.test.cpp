@@ -0,0 +1,101 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cpe/linearsolver/cg.hpp>
+#include <cpe/linearsolver/schwarz.hpp>
+#include <cpe/linearsolver/springchain.test.hpp>
+#include <stdexcept>
+
+namespace {
+
+using cpe::linearsolver::schwarz::Subdomains;
+
+using cpe::linearsolver::testing::SpringChain;
+
+TEST(SchwarzTest, Partition) {
+  cpe::matrix::Matrix A(10, 10);
+  for (std::size_t i = 0; i < 10; ++i) {
+    A[i, i] = 2.0;
+    if (i > 0) A[i, i - 1] = A[i - 1, i] = -1.0;
+  }
+  Subdomains disjoint = cpe::linearsolver::schwarz::Partition(A, 2, 0);
+  ASSERT_EQ(disjoint.size(), 2);
+  EXPECT_EQ(disjoint[0], std::vector<std::size_t>({0, 1, 2, 3, 4}));
+  EXPECT_EQ(disjoint[1], std::vector<std::size_t>({5, 6, 7, 8, 9}));
+
+  Subdomains overlapping = cpe::linearsolver::schwarz::Partition(A, 2, 2);
+  ASSERT_EQ(overlapping.size(), 2);
+  EXPECT_EQ(overlapping[0], std::vector<std::size_t>({0, 1, 2, 3, 4, 5, 6}));
+  EXPECT_EQ(overlapping[1], std::vector<std::size_t>({3, 4, 5, 6, 7, 8, 9}));
+
+  EXPECT_EQ(cpe::linearsolver::schwarz::Partition(A, 20).size(), 10);
+}
+
+TEST(SchwarzTest, Preconditioner) {
+  constexpr std::size_t n = 400;
+  cpe::matrix::Matrix A = SpringChain(n, 0.5);
+  cpe::matrix::Matrix b(n, 1);
+  b[n - 1] = 1.0;
+
+  cpe::matrix::Matrix x_jacobi(n, 1);
+  int jacobi_iter = cpe::linearsolver::cg::Solve(
+      A, x_jacobi, b, cpe::linearsolver::preconditioner::Jacobi(A), 1.0e-8);
+  ASSERT_GT(jacobi_iter, 0);
+
+  Subdomains subdomains = cpe::linearsolver::schwarz::Partition(A, 40);
+  cpe::matrix::Matrix x_local(n, 1);
+  int local_iter = cpe::linearsolver::cg::Solve(
+      A, x_local, b,
+      cpe::linearsolver::schwarz::AdditiveSchwarz(A, subdomains), 1.0e-8);
+  EXPECT_GT(local_iter, 0);
+  EXPECT_LT(local_iter, jacobi_iter / 4);
+
+  // The coarse correction helps, and threads do not change the result
+  std::vector<cpe::matrix::Matrix> solutions;
+  std::vector<int> iterations;
+  for (std::size_t num_threads : {1, 3}) {
+    cpe::parallel::ThreadPool pool(num_threads);
+    auto M = cpe::linearsolver::schwarz::AdditiveSchwarz(A, subdomains, &pool,
+                                                          1);
+    solutions.emplace_back(n, 1);
+    iterations.push_back(
+        cpe::linearsolver::cg::Solve(A, solutions.back(), b, M, 1.0e-8));
+  }
+  EXPECT_GT(iterations[0], 0);
+  EXPECT_LT(iterations[0], local_iter / 2);
+  EXPECT_EQ(iterations[1], iterations[0]);
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(solutions[1][i], solutions[0][i]);
+    EXPECT_NEAR(solutions[0][i], x_jacobi[i], 1.0e-5);
+  }
+}
+
+TEST(SchwarzTest, Singular) {
+  cpe::matrix::Matrix A(4, 4);
+  A[0, 0] = A[1, 1] = A[3, 3] = 1.0;
+  Subdomains subdomains = cpe::linearsolver::schwarz::Partition(A, 2, 0);
+  EXPECT_THROW(cpe::linearsolver::schwarz::AdditiveSchwarz(A, subdomains),
+               std::runtime_error);
+}
+
+}  // namespace
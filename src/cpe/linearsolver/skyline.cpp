@@ -0,0 +1,94 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <algorithm>
+#include <cmath>
+#include <cpe/linearsolver/skyline.hpp>
+
+namespace cpe::linearsolver::skyline {
+
+namespace {
+
+std::size_t FirstNonzero(const cpe::matrix::Matrix& A, std::size_t i) {
+  std::size_t j = 0;
+  while (j < i && A[i, j] == 0.0) ++j;
+  return j;
+}
+
+}  // namespace
+
+std::size_t GetProfileSize(const cpe::matrix::Matrix& A) {
+  std::size_t size = 0;
+  for (std::size_t i = 0; i < A.GetNumRows(); ++i) {
+    size += i + 1 - FirstNonzero(A, i);
+  }
+  return size;
+}
+
+bool Factorization::Factor(const cpe::matrix::Matrix& A) {
+  const std::size_t n = A.GetNumRows();
+  first_.resize(n);
+  offsets_.resize(n + 1);
+  offsets_[0] = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    first_[i] = FirstNonzero(A, i);
+    offsets_[i + 1] = offsets_[i] + i + 1 - first_[i];
+  }
+  values_.resize(offsets_[n]);
+
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = first_[i]; j < i; ++j) {
+      double value = A[i, j];
+      for (std::size_t k = std::max(first_[i], first_[j]); k < j; ++k) {
+        value -= L(i, k) * L(j, k);
+      }
+      L(i, j) = value / L(j, j);
+    }
+    double diagonal = A[i, i];
+    for (std::size_t k = first_[i]; k < i; ++k) diagonal -= L(i, k) * L(i, k);
+    if (!(diagonal > 0.0)) return false;
+    L(i, i) = std::sqrt(diagonal);
+  }
+  return true;
+}
+
+void Factorization::Solve(cpe::matrix::Matrix& x) const {
+  const std::size_t n = GetNumRows();
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t k = first_[i]; k < i; ++k) x[i] -= L(i, k) * x[k];
+    x[i] /= L(i, i);
+  }
+  for (std::size_t i = n; i-- > 0;) {
+    x[i] /= L(i, i);
+    for (std::size_t k = first_[i]; k < i; ++k) x[k] -= L(i, k) * x[i];
+  }
+}
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b) {
+  Factorization factorization;
+  if (!factorization.Factor(A)) return -1;
+  x = b;
+  factorization.Solve(x);
+  return 1;
+}
+
+}  // namespace cpe::linearsolver::skyline
@@ -0,0 +1,62 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpe/matrix/matrix.hpp>
+#include <vector>
+
+namespace cpe::linearsolver::skyline {
+
+// Number of entries in the lower profile (envelope) of a symmetric matrix,
+// from the first nonzero of each row through its diagonal
+std::size_t GetProfileSize(const cpe::matrix::Matrix& A);
+
+// Cholesky factorization A = L L^T of a symmetric positive definite matrix.
+// L fills in only within the profile of A, so only the profile is stored.
+class Factorization {
+ public:
+  bool Factor(const cpe::matrix::Matrix& A);
+  std::size_t GetAllocatedSize() const {
+    return sizeof(double) * values_.capacity() +
+           sizeof(std::size_t) * (first_.capacity() + offsets_.capacity());
+  }
+  std::size_t GetNumRows() const { return first_.size(); }
+  std::size_t GetProfileSize() const { return values_.size(); }
+  void Solve(cpe::matrix::Matrix& x) const;
+
+ private:
+  double& L(std::size_t i, std::size_t j) {
+    return values_[offsets_[i] + j - first_[i]];
+  }
+  double L(std::size_t i, std::size_t j) const {
+    return values_[offsets_[i] + j - first_[i]];
+  }
+
+  std::vector<std::size_t> first_;
+  std::vector<std::size_t> offsets_;
+  std::vector<double> values_;
+};
+
+int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+          const cpe::matrix::Matrix& b);
+
+}  // namespace cpe::linearsolver::skyline
@@ -0,0 +1,83 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cpe/linearsolver/skyline.hpp>
+
+namespace {
+
+TEST(SkylineTest, Solve) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  cpe::matrix::Matrix x(5, 1);
+  int num_iter = cpe::linearsolver::skyline::Solve(A, x, b);
+  EXPECT_EQ(num_iter, 1);
+  EXPECT_NEAR(x[0], 25.000000, 0.0001);
+  EXPECT_NEAR(x[1], 35.714285, 0.0001);
+  EXPECT_NEAR(x[2], 42.857143, 0.0001);
+  EXPECT_NEAR(x[3], 35.714285, 0.0001);
+  EXPECT_NEAR(x[4], 25.000000, 0.0001);
+}
+
+TEST(SkylineTest, Profile) {
+  // Tridiagonal apart from one long row
+  constexpr std::size_t n = 50;
+  cpe::matrix::Matrix A(n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    A[i, i] = 4.0;
+    if (i > 0) A[i, i - 1] = A[i - 1, i] = -1.0;
+  }
+  A[40, 10] = A[10, 40] = -1.0;
+  EXPECT_EQ(cpe::linearsolver::skyline::GetProfileSize(A),
+            1 + 2 * (n - 1) + (40 - 10 - 1));
+
+  cpe::linearsolver::skyline::Factorization factorization;
+  ASSERT_TRUE(factorization.Factor(A));
+  EXPECT_EQ(factorization.GetNumRows(), n);
+  EXPECT_EQ(factorization.GetProfileSize(),
+            cpe::linearsolver::skyline::GetProfileSize(A));
+  EXPECT_LT(factorization.GetAllocatedSize(), sizeof(double) * n * n / 4);
+
+  cpe::matrix::Matrix x(n, 1);
+  for (std::size_t i = 0; i < n; ++i) x[i] = 1.0;
+  cpe::matrix::Matrix b(n, 1);
+  cpe::matrix::Multiply(A, x, b);
+  factorization.Solve(b);
+  for (std::size_t i = 0; i < n; ++i) EXPECT_NEAR(b[i], 1.0, 1.0e-12);
+}
+
+TEST(SkylineTest, Fail) {
+  cpe::matrix::Matrix A(2, 2);
+  A[0, 0] = 1.0;
+  A[1, 1] = -1.0;
+  cpe::matrix::Matrix b(2, 1);
+  b[0] = b[1] = 1.0;
+  cpe::matrix::Matrix x(2, 1);
+  EXPECT_EQ(cpe::linearsolver::skyline::Solve(A, x, b), -1);
+}
+
+}  // namespace
@@ -0,0 +1,46 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cmath>
+#include <cpe/matrix/matrix.hpp>
+
+namespace cpe::linearsolver::testing {
+
+// Stiffness of a chain of n springs fixed at one end, with spring i scaled by
+// 1 + perturbation * sin(i)
+inline cpe::matrix::Matrix SpringChain(std::size_t n,
+                                       double perturbation = 0.0) {
+  cpe::matrix::Matrix A(n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double k = 1.0 + perturbation * std::sin(static_cast<double>(i));
+    A[i, i] += k;
+    if (i > 0) {
+      A[i - 1, i - 1] += k;
+      A[i - 1, i] -= k;
+      A[i, i - 1] -= k;
+    }
+  }
+  return A;
+}
+
+}  // namespace cpe::linearsolver::testing
@@ -90,4 +90,33 @@ int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
   return converged ? iteration_count : -1;
 }
 
+void Sweep(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+           const cpe::matrix::Matrix& b, double relaxation_factor) {
+  for (std::size_t i = 0; i < A.GetNumRows(); ++i) {
+    double residual = b[i];
+    for (std::size_t j = 0; j < A.GetNumRows(); ++j) {
+      residual -= A[i, j] * x[j];
+    }
+    x[i] += relaxation_factor * residual / A[i, i];
+  }
+}
+
+void Sweep(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+           const cpe::matrix::Matrix& b,
+           const cpe::linearsolver::triangular::Schedule& schedule,
+           cpe::parallel::ThreadPool& pool, double relaxation_factor) {
+  // (D / w + L) x = b - (U + (1 - 1 / w) D) x
+  const std::size_t n = A.GetNumRows();
+  const double diagonal_weight = 1.0 - 1.0 / relaxation_factor;
+  cpe::matrix::Matrix rhs(n, 1);
+  pool.ParallelFor(n, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      rhs[i] = b[i] - diagonal_weight * A[i, i] * x[i];
+      for (std::size_t j = i + 1; j < n; ++j) rhs[i] -= A[i, j] * x[j];
+    }
+  });
+  cpe::linearsolver::triangular::Solve(schedule, A, x, rhs, pool,
+                                       relaxation_factor);
+}
+
 }  // namespace cpe::linearsolver::ssor
@@ -21,7 +21,9 @@
 // SOFTWARE.
 #pragma once
 
+#include <cpe/linearsolver/triangular.hpp>
 #include <cpe/matrix/matrix.hpp>
+#include <cpe/parallel/threadpool.hpp>
 #include <vector>
 
 namespace cpe::linearsolver::ssor {
@@ -30,4 +32,15 @@ int Solve(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
           const cpe::matrix::Matrix& b, double tolerance = 1.0e-6,
           double relaxation_factor = 1.0);
 
+// A single relaxation sweep, updating x in place
+void Sweep(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+           const cpe::matrix::Matrix& b, double relaxation_factor = 1.0);
+
+// A single sweep as a level-scheduled lower triangular solve, where schedule
+// is the Triangle::kLower schedule of A
+void Sweep(const cpe::matrix::Matrix& A, cpe::matrix::Matrix& x,
+           const cpe::matrix::Matrix& b,
+           const cpe::linearsolver::triangular::Schedule& schedule,
+           cpe::parallel::ThreadPool& pool, double relaxation_factor = 1.0);
+
 }  // namespace cpe::linearsolver::ssor
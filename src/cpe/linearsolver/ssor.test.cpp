@@ -74,4 +74,40 @@ TEST(SSORTest, Fail) {
   EXPECT_EQ(num_iter, -1);
 }
 
+TEST(SSORTest, Sweep) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  cpe::matrix::Matrix x(5, 1);
+  cpe::linearsolver::ssor::Sweep(A, x, b, 1.0);
+  EXPECT_DOUBLE_EQ(x[0], 25.0);
+  EXPECT_DOUBLE_EQ(x[1], 31.25);
+  EXPECT_DOUBLE_EQ(x[2], 32.8125);
+  EXPECT_DOUBLE_EQ(x[3], 26.953125);
+  EXPECT_DOUBLE_EQ(x[4], 23.92578125);
+}
+
+TEST(SSORTest, SweepThreaded) {
+  cpe::matrix::Matrix A(5, 5);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  cpe::matrix::Matrix b(5, 1);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  cpe::linearsolver::triangular::Schedule schedule(
+      A, cpe::linearsolver::triangular::Triangle::kLower);
+  cpe::parallel::ThreadPool pool(2);
+  cpe::matrix::Matrix x(5, 1);
+  cpe::matrix::Matrix y(5, 1);
+  for (std::size_t i = 0; i < 5; ++i) x[i] = y[i] = 10.0 * i;
+  cpe::linearsolver::ssor::Sweep(A, x, b, 1.5);
+  cpe::linearsolver::ssor::Sweep(A, y, b, schedule, pool, 1.5);
+  for (std::size_t i = 0; i < 5; ++i) EXPECT_NEAR(y[i], x[i], 1.0e-12);
+}
+
 }  // namespace
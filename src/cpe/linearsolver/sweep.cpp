@@ -0,0 +1,99 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpe/linearsolver/gmres.hpp>
+#include <cpe/linearsolver/lu.hpp>
+#include <cpe/linearsolver/sweep.hpp>
+
+namespace cpe::linearsolver::sweep {
+
+namespace {
+
+using cpe::matrix::Matrix;
+
+// A = K - shift M
+void Shift(const Matrix& K, const Matrix& M, double shift, Matrix& A) {
+  for (std::size_t i = 0; i < K.GetNumRows(); ++i) {
+    for (std::size_t j = 0; j < K.GetNumColumns(); ++j) {
+      A[i, j] = K[i, j] - shift * M[i, j];
+    }
+  }
+}
+
+}  // namespace
+
+int Solve(const Matrix& K, const Matrix& M, const Matrix& b,
+          const std::vector<double>& omegas, Matrix& x, Report& report,
+          double tolerance, int maximum_iterations) {
+  const std::size_t n = K.GetNumRows();
+  x = Matrix(n, omegas.size());
+  report = Report();
+
+  Matrix A(n, n);
+  lu::Factorization<double> factorization;
+  bool factored = false;
+  auto refactor = [&](double shift) {
+    factored = factorization.Factor(A);
+    if (factored) report.shifts_.push_back(shift);
+    return factored;
+  };
+  const cpe::linearsolver::preconditioner::Preconditioner preconditioner =
+      [&factorization](const Matrix& r, Matrix& z) {
+        z = r;
+        factorization.Solve(z);
+      };
+
+  Matrix guess(n, 1);
+  int total = 0;
+  for (std::size_t f = 0; f < omegas.size(); ++f) {
+    const double shift = omegas[f] * omegas[f];
+    Shift(K, M, shift, A);
+    if (!factored && !refactor(shift)) return -1;
+
+    // Linear extrapolation from the last two frequencies
+    if (f >= 2 && omegas[f - 1] != omegas[f - 2]) {
+      const double t =
+          (omegas[f] - omegas[f - 1]) / (omegas[f - 1] - omegas[f - 2]);
+      for (std::size_t i = 0; i < n; ++i) {
+        guess[i] = x[i, f - 1] + t * (x[i, f - 1] - x[i, f - 2]);
+      }
+    }
+    int iterations =
+        gmres::Solve(A, guess, b, preconditioner, tolerance,
+                     maximum_iterations, maximum_iterations);
+    if (iterations < 0) {
+      if (!refactor(shift)) return -1;
+      const int retry = gmres::Solve(A, guess, b, preconditioner, tolerance,
+                                     maximum_iterations, maximum_iterations);
+      if (retry < 0) return -1;
+      iterations = maximum_iterations + retry;
+    } else if (2 * iterations > maximum_iterations) {
+      // The preconditioner is going stale, renew it for the next frequency
+      factored = false;
+    }
+    report.iterations_.push_back(iterations);
+    total += iterations;
+    for (std::size_t i = 0; i < n; ++i) x[i, f] = guess[i];
+  }
+  return total;
+}
+
+}  // namespace cpe::linearsolver::sweep
@@ -0,0 +1,49 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpe/matrix/matrix.hpp>
+#include <vector>
+
+namespace cpe::linearsolver::sweep {
+
+struct Report {
+  // Shift omega^2 of each factorization of K - shift M
+  std::vector<double> shifts_;
+  // GMRES iterations at each frequency
+  std::vector<int> iterations_;
+};
+
+// Solves (K - omega^2 M) x = b at each circular frequency in omegas, in the
+// given order, into the columns of x.  Each solve starts from the previous
+// solutions extrapolated to the new frequency and runs GMRES preconditioned
+// by an LU factorization of K - shift M from an earlier frequency.  The
+// factorization is only renewed, at the current frequency, once GMRES needs
+// more than half of maximum_iterations, so a sweep through closely spaced
+// frequencies costs a few factorizations.  Returns the total number of GMRES
+// iterations, or -1 if a frequency could not be solved, e.g. at resonance.
+int Solve(const cpe::matrix::Matrix& K, const cpe::matrix::Matrix& M,
+          const cpe::matrix::Matrix& b, const std::vector<double>& omegas,
+          cpe::matrix::Matrix& x, Report& report, double tolerance = 1.0e-10,
+          int maximum_iterations = 20);
+
+}  // namespace cpe::linearsolver::sweep
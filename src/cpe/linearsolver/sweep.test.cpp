@@ -0,0 +1,98 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cpe/linearsolver/lu.hpp>
+#include <cpe/linearsolver/springchain.test.hpp>
+#include <cpe/linearsolver/sweep.hpp>
+#include <vector>
+
+namespace {
+
+using cpe::linearsolver::testing::SpringChain;
+
+TEST(SweepTest, Solve) {
+  constexpr std::size_t n = 60;
+  constexpr std::size_t num_frequencies = 100;
+  const cpe::matrix::Matrix K = SpringChain(n, 0.3);
+  cpe::matrix::Matrix M(n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    M[i, i] = 1.0 + 0.5 * std::cos(static_cast<double>(i));
+  }
+  cpe::matrix::Matrix b(n, 1);
+  b[n - 1] = 1.0;
+  // Through the first few resonances, avoiding each of them
+  std::vector<double> omegas;
+  for (std::size_t f = 0; f < num_frequencies; ++f) {
+    omegas.push_back(0.002 + 0.0015 * static_cast<double>(f));
+  }
+
+  cpe::matrix::Matrix x(1, 1);
+  cpe::linearsolver::sweep::Report report;
+  const int num_iter =
+      cpe::linearsolver::sweep::Solve(K, M, b, omegas, x, report);
+  ASSERT_GT(num_iter, 0);
+  ASSERT_EQ(x.GetNumColumns(), num_frequencies);
+  ASSERT_EQ(report.iterations_.size(), num_frequencies);
+  EXPECT_GE(report.shifts_.size(), 2);
+  EXPECT_LT(report.shifts_.size(), num_frequencies / 4);
+
+  for (std::size_t f = 0; f < num_frequencies; ++f) {
+    cpe::matrix::Matrix A(n, n);
+    const double shift = omegas[f] * omegas[f];
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        A[i, j] = K[i, j] - shift * M[i, j];
+      }
+    }
+    cpe::matrix::Matrix x_ref(n, 1);
+    ASSERT_EQ(cpe::linearsolver::lu::Solve(A, x_ref, b), 1);
+    double scale = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      scale = std::max(scale, std::abs(x_ref[i]));
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      const double value = x[i, f];
+      EXPECT_NEAR(value, x_ref[i], 1.0e-8 * scale);
+    }
+  }
+}
+
+TEST(SweepTest, Resonance) {
+  cpe::matrix::Matrix K(2, 2);
+  K[0, 0] = 4.0;
+  K[1, 1] = 9.0;
+  cpe::matrix::Matrix M(2, 2);
+  M[0, 0] = M[1, 1] = 1.0;
+  cpe::matrix::Matrix b(2, 1);
+  b[0] = b[1] = 1.0;
+  cpe::matrix::Matrix x(1, 1);
+  cpe::linearsolver::sweep::Report report;
+  EXPECT_GT(cpe::linearsolver::sweep::Solve(K, M, b, {1.0}, x, report), 0);
+  EXPECT_NEAR(x[0], 1.0 / 3.0, 1.0e-12);
+  EXPECT_NEAR(x[1], 1.0 / 8.0, 1.0e-12);
+  EXPECT_EQ(cpe::linearsolver::sweep::Solve(K, M, b, {1.0, 2.0}, x, report),
+            -1);
+}
+
+}  // namespace
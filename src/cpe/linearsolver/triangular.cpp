@@ -0,0 +1,91 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <algorithm>
+#include <cpe/linearsolver/triangular.hpp>
+
+namespace cpe::linearsolver::triangular {
+
+Schedule::Schedule(const cpe::matrix::Matrix& A, Triangle triangle)
+    : triangle_(triangle) {
+  const std::size_t n = A.GetNumRows();
+  row_offsets_.resize(n + 1, 0);
+  for (std::size_t i = 0; i < n; ++i) {
+    const std::size_t begin = triangle == Triangle::kLower ? 0 : i + 1;
+    const std::size_t end = triangle == Triangle::kLower ? i : n;
+    for (std::size_t j = begin; j < end; ++j) {
+      if (A[i, j] != 0.0) columns_.push_back(j);
+    }
+    row_offsets_[i + 1] = columns_.size();
+  }
+
+  // A row's level is one past the deepest row it depends on
+  std::vector<std::size_t> level(n, 0);
+  std::size_t num_levels = 0;
+  for (std::size_t k = 0; k < n; ++k) {
+    const std::size_t i = triangle == Triangle::kLower ? k : n - 1 - k;
+    for (std::size_t c = row_offsets_[i]; c < row_offsets_[i + 1]; ++c) {
+      level[i] = std::max(level[i], level[columns_[c]] + 1);
+    }
+    num_levels = std::max(num_levels, level[i] + 1);
+  }
+
+  level_offsets_.assign(num_levels + 1, 0);
+  for (std::size_t i = 0; i < n; ++i) level_offsets_[level[i] + 1]++;
+  for (std::size_t l = 0; l < num_levels; ++l) {
+    level_offsets_[l + 1] += level_offsets_[l];
+  }
+  rows_.resize(n);
+  std::vector<std::size_t> next(level_offsets_.begin(),
+                                level_offsets_.end() - 1);
+  for (std::size_t i = 0; i < n; ++i) rows_[next[level[i]]++] = i;
+}
+
+void Solve(const Schedule& schedule, const cpe::matrix::Matrix& A,
+           cpe::matrix::Matrix& x, const cpe::matrix::Matrix& b,
+           cpe::parallel::ThreadPool& pool, double relaxation_factor) {
+  // Levels this narrow are not worth handing to other threads
+  constexpr std::size_t min_parallel_rows = 64;
+  const auto solve_rows = [&](std::size_t begin, std::size_t end) {
+    for (std::size_t r = begin; r < end; ++r) {
+      const std::size_t i = schedule.rows_[r];
+      double value = b[i];
+      for (std::size_t c = schedule.row_offsets_[i];
+           c < schedule.row_offsets_[i + 1]; ++c) {
+        value -= A[i, schedule.columns_[c]] * x[schedule.columns_[c]];
+      }
+      x[i] = relaxation_factor * value / A[i, i];
+    }
+  };
+  for (std::size_t l = 0; l < schedule.GetNumLevels(); ++l) {
+    const std::size_t first = schedule.level_offsets_[l];
+    const std::size_t size = schedule.level_offsets_[l + 1] - first;
+    if (size < min_parallel_rows || pool.GetNumThreads() == 1) {
+      solve_rows(first, first + size);
+    } else {
+      pool.ParallelFor(size, [&](std::size_t begin, std::size_t end) {
+        solve_rows(first + begin, first + end);
+      });
+    }
+  }
+}
+
+}  // namespace cpe::linearsolver::triangular
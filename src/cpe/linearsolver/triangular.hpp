@@ -0,0 +1,63 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cpe/matrix/matrix.hpp>
+#include <cpe/parallel/threadpool.hpp>
+#include <vector>
+
+namespace cpe::linearsolver::triangular {
+
+enum class Triangle { kLower, kUpper };
+
+// Level schedule of the dependency graph of one triangle of A.  Each row of a
+// level depends only on rows of earlier levels, so the rows of a level can be
+// solved concurrently.  The schedule depends only on the sparsity pattern and
+// can be reused while the values change.
+class Schedule {
+ public:
+  Schedule(const cpe::matrix::Matrix& A, Triangle triangle);
+
+  std::size_t GetNumLevels() const { return level_offsets_.size() - 1; }
+  std::size_t GetNumRows() const { return row_offsets_.size() - 1; }
+  Triangle GetTriangle() const { return triangle_; }
+
+  // Rows of level l are rows_[level_offsets_[l]] to rows_[level_offsets_[l+1]]
+  std::vector<std::size_t> level_offsets_;
+  std::vector<std::size_t> rows_;
+  // Off-diagonal columns of row i within the triangle are columns_[
+  // row_offsets_[i]] to columns_[row_offsets_[i+1]]
+  std::vector<std::size_t> row_offsets_;
+  std::vector<std::size_t> columns_;
+
+ private:
+  Triangle triangle_;
+};
+
+// Solves (D / relaxation_factor + T) x = b, where T is the strict triangle of
+// A given by schedule and D its diagonal, one level at a time with the rows
+// of each level spread over pool.
+void Solve(const Schedule& schedule, const cpe::matrix::Matrix& A,
+           cpe::matrix::Matrix& x, const cpe::matrix::Matrix& b,
+           cpe::parallel::ThreadPool& pool, double relaxation_factor = 1.0);
+
+}  // namespace cpe::linearsolver::triangular
@@ -0,0 +1,126 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cpe/linearsolver/triangular.hpp>
+
+namespace {
+
+using cpe::linearsolver::triangular::Schedule;
+using cpe::linearsolver::triangular::Triangle;
+
+// Five point Laplacian on an nx by ny grid, numbered along x first
+cpe::matrix::Matrix Grid(std::size_t nx, std::size_t ny) {
+  cpe::matrix::Matrix A(nx * ny, nx * ny);
+  for (std::size_t y = 0; y < ny; ++y) {
+    for (std::size_t x = 0; x < nx; ++x) {
+      const std::size_t i = y * nx + x;
+      A[i, i] = 4.0;
+      if (x > 0) A[i, i - 1] = A[i - 1, i] = -1.0;
+      if (y > 0) A[i, i - nx] = A[i - nx, i] = -1.0;
+    }
+  }
+  return A;
+}
+
+TEST(TriangularTest, Schedule) {
+  cpe::matrix::Matrix D(4, 4);
+  D[0, 0] = D[1, 1] = D[2, 2] = D[3, 3] = 1.0;
+  Schedule diagonal(D, Triangle::kLower);
+  EXPECT_EQ(diagonal.GetNumRows(), 4);
+  EXPECT_EQ(diagonal.GetNumLevels(), 1);
+
+  // Anti-diagonal wavefronts of the grid are independent
+  constexpr std::size_t nx = 7;
+  constexpr std::size_t ny = 5;
+  cpe::matrix::Matrix A = Grid(nx, ny);
+  for (Triangle triangle : {Triangle::kLower, Triangle::kUpper}) {
+    Schedule schedule(A, triangle);
+    EXPECT_EQ(schedule.GetTriangle(), triangle);
+    EXPECT_EQ(schedule.GetNumLevels(), nx + ny - 1);
+    EXPECT_EQ(schedule.rows_.size(), nx * ny);
+    EXPECT_EQ(schedule.columns_.size(), (nx - 1) * ny + nx * (ny - 1));
+    std::vector<std::size_t> level(nx * ny);
+    for (std::size_t l = 0; l < schedule.GetNumLevels(); ++l) {
+      for (std::size_t r = schedule.level_offsets_[l];
+           r < schedule.level_offsets_[l + 1]; ++r) {
+        level[schedule.rows_[r]] = l;
+      }
+    }
+    for (std::size_t i = 0; i < nx * ny; ++i) {
+      for (std::size_t c = schedule.row_offsets_[i];
+           c < schedule.row_offsets_[i + 1]; ++c) {
+        EXPECT_LT(level[schedule.columns_[c]], level[i]);
+      }
+    }
+  }
+}
+
+// Checks solves of (D / w + T) x = b for both triangles of A against a known x
+void CheckSolve(const cpe::matrix::Matrix& A) {
+  const std::size_t n = A.GetNumRows();
+  cpe::matrix::Matrix expected(n, 1);
+  for (std::size_t i = 0; i < n; ++i) {
+    expected[i] = std::sin(static_cast<double>(i));
+  }
+  for (Triangle triangle : {Triangle::kLower, Triangle::kUpper}) {
+    Schedule schedule(A, triangle);
+    for (double relaxation_factor : {1.0, 1.5}) {
+      cpe::matrix::Matrix b(n, 1);
+      for (std::size_t i = 0; i < n; ++i) {
+        b[i] = A[i, i] / relaxation_factor * expected[i];
+        const std::size_t begin = triangle == Triangle::kLower ? 0 : i + 1;
+        const std::size_t end = triangle == Triangle::kLower ? i : n;
+        for (std::size_t j = begin; j < end; ++j) {
+          b[i] += A[i, j] * expected[j];
+        }
+      }
+      for (std::size_t num_threads : {1, 2, 4}) {
+        cpe::parallel::ThreadPool pool(num_threads);
+        cpe::matrix::Matrix x(n, 1);
+        cpe::linearsolver::triangular::Solve(schedule, A, x, b, pool,
+                                             relaxation_factor);
+        for (std::size_t i = 0; i < n; ++i) {
+          EXPECT_NEAR(x[i], expected[i], 1.0e-12);
+        }
+      }
+    }
+  }
+}
+
+TEST(TriangularTest, Solve) {
+  // Many narrow levels, solved inline
+  CheckSolve(Grid(40, 30));
+
+  // A few wide levels, spread over the threads
+  constexpr std::size_t n = 1200;
+  cpe::matrix::Matrix A(n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    A[i, i] = 4.0;
+    if (i >= 200) A[i, i - 200] = A[i - 200, i] = -1.0;
+  }
+  EXPECT_EQ(Schedule(A, Triangle::kLower).GetNumLevels(), n / 200);
+  CheckSolve(A);
+}
+
+}  // namespace
@@ -0,0 +1,92 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <algorithm>
+#include <cmath>
+#include <cpe/matrix/eigen.hpp>
+#include <numeric>
+#include <vector>
+
+namespace cpe::matrix {
+
+void SymmetricEigen(const Matrix& A, Matrix& values, Matrix& vectors) {
+  constexpr int maximum_sweeps = 100;
+  const std::size_t n = A.GetNumRows();
+  Matrix a = A;
+  Matrix v(n, n);
+  for (std::size_t i = 0; i < n; ++i) v[i, i] = 1.0;
+
+  double total = 0.0;
+  for (std::size_t i = 0; i < n * n; ++i) total += a[i] * a[i];
+
+  for (int sweep = 0; sweep < maximum_sweeps; ++sweep) {
+    double off_diagonal = 0.0;
+    for (std::size_t p = 0; p < n; ++p) {
+      for (std::size_t q = p + 1; q < n; ++q) off_diagonal += a[p, q] * a[p, q];
+    }
+    if (off_diagonal <= 1.0e-30 * total) break;
+
+    for (std::size_t p = 0; p < n; ++p) {
+      for (std::size_t q = p + 1; q < n; ++q) {
+        const double apq = a[p, q];
+        if (apq == 0.0) continue;
+        const double theta = (a[q, q] - a[p, p]) / (2.0 * apq);
+        const double t = std::copysign(1.0, theta) /
+                         (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+        const double c = 1.0 / std::sqrt(t * t + 1.0);
+        const double s = t * c;
+        for (std::size_t k = 0; k < n; ++k) {
+          const double akp = a[k, p];
+          const double akq = a[k, q];
+          a[k, p] = c * akp - s * akq;
+          a[k, q] = s * akp + c * akq;
+        }
+        for (std::size_t k = 0; k < n; ++k) {
+          const double apk = a[p, k];
+          const double aqk = a[q, k];
+          a[p, k] = c * apk - s * aqk;
+          a[q, k] = s * apk + c * aqk;
+        }
+        for (std::size_t k = 0; k < n; ++k) {
+          const double vkp = v[k, p];
+          const double vkq = v[k, q];
+          v[k, p] = c * vkp - s * vkq;
+          v[k, q] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+
+  std::vector<std::size_t> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&a](std::size_t i, std::size_t j) {
+    return a[i, i] < a[j, j];
+  });
+
+  values = Matrix(n, 1);
+  vectors = Matrix(n, n);
+  for (std::size_t j = 0; j < n; ++j) {
+    values[j] = a[order[j], order[j]];
+    for (std::size_t i = 0; i < n; ++i) vectors[i, j] = v[i, order[j]];
+  }
+}
+
+}  // namespace cpe::matrix
@@ -0,0 +1,75 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cpe/matrix/eigen.hpp>
+
+namespace {
+
+TEST(EigenTest, Diagonal) {
+  cpe::matrix::Matrix A(3, 3);
+  A[0, 0] = 3.0;
+  A[1, 1] = 1.0;
+  A[2, 2] = 2.0;
+  cpe::matrix::Matrix values(1, 1);
+  cpe::matrix::Matrix vectors(1, 1);
+  cpe::matrix::SymmetricEigen(A, values, vectors);
+  EXPECT_EQ(values.GetNumRows(), 3);
+  EXPECT_EQ(values[0], 1.0);
+  EXPECT_EQ(values[1], 2.0);
+  EXPECT_EQ(values[2], 3.0);
+  const double v10 = vectors[1, 0];
+  const double v21 = vectors[2, 1];
+  const double v02 = vectors[0, 2];
+  EXPECT_EQ(std::abs(v10), 1.0);
+  EXPECT_EQ(std::abs(v21), 1.0);
+  EXPECT_EQ(std::abs(v02), 1.0);
+}
+
+TEST(EigenTest, Tridiagonal) {
+  // The eigenvalues of tridiag(-1, 2, -1) are 2 - 2 cos(k pi / (n + 1))
+  constexpr std::size_t n = 8;
+  const double kPi = std::acos(-1.0);
+  cpe::matrix::Matrix A(n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    A[i, i] = 2.0;
+    if (i > 0) A[i, i - 1] = A[i - 1, i] = -1.0;
+  }
+  cpe::matrix::Matrix values(1, 1);
+  cpe::matrix::Matrix vectors(1, 1);
+  cpe::matrix::SymmetricEigen(A, values, vectors);
+  for (std::size_t k = 0; k < n; ++k) {
+    const double expected =
+        2.0 - 2.0 * std::cos(static_cast<double>(k + 1) * kPi / (n + 1));
+    EXPECT_NEAR(values[k], expected, 1.0e-12);
+    // Check A v = lambda v
+    for (std::size_t i = 0; i < n; ++i) {
+      double av = 0.0;
+      for (std::size_t j = 0; j < n; ++j) av += A[i, j] * vectors[j, k];
+      const double v = vectors[i, k];
+      EXPECT_NEAR(av, values[k] * v, 1.0e-12);
+    }
+  }
+}
+
+}  // namespace
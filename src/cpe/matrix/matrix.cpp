@@ -70,4 +70,44 @@ Matrix Matrix::Transpose() const {
   return result;
 }
 
+double Dot(const Matrix& a, const Matrix& b) {
+  double result = 0.0;
+  for (std::size_t i = 0; i < a.GetNumRows(); ++i) result += a[i] * b[i];
+  return result;
+}
+
+double Dot(const Matrix& a, const Matrix& b, cpe::parallel::ThreadPool& pool) {
+  const std::size_t n = a.GetNumRows();
+  std::vector<double> partial(pool.GetNumPartials(n), 0.0);
+  pool.ParallelReduce(
+      n, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        double sum = 0.0;
+        for (std::size_t i = begin; i < end; ++i) sum += a[i] * b[i];
+        partial[chunk] = sum;
+      });
+  return cpe::parallel::PairwiseSum(partial);
+}
+
+void Multiply(const Matrix& A, const Matrix& x, Matrix& y) {
+  // Matrix-vector product, y = A * x, without copying A
+  for (std::size_t i = 0; i < A.GetNumRows(); ++i) {
+    double sum = 0.0;
+    for (std::size_t j = 0; j < A.GetNumColumns(); ++j) sum += A[i, j] * x[j];
+    y[i] = sum;
+  }
+}
+
+void Multiply(const Matrix& A, const Matrix& x, Matrix& y,
+              cpe::parallel::ThreadPool& pool) {
+  pool.ParallelFor(A.GetNumRows(), [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      double sum = 0.0;
+      for (std::size_t j = 0; j < A.GetNumColumns(); ++j) {
+        sum += A[i, j] * x[j];
+      }
+      y[i] = sum;
+    }
+  });
+}
+
 }  // namespace cpe::matrix
@@ -21,6 +21,7 @@
 // SOFTWARE.
 #pragma once
 
+#include <cpe/parallel/threadpool.hpp>
 #include <vector>
 
 namespace cpe::matrix {
@@ -60,4 +61,10 @@ class Matrix {
   std::vector<double> data_;
 };
 
+double Dot(const Matrix& a, const Matrix& b);
+double Dot(const Matrix& a, const Matrix& b, cpe::parallel::ThreadPool& pool);
+void Multiply(const Matrix& A, const Matrix& x, Matrix& y);
+void Multiply(const Matrix& A, const Matrix& x, Matrix& y,
+              cpe::parallel::ThreadPool& pool);
+
 }  // namespace cpe::matrix
@@ -21,6 +21,7 @@
 // SOFTWARE.
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <cpe/matrix/matrix.hpp>
 
 namespace {
@@ -207,4 +208,75 @@ TEST(MatrixTest, Transpose) {
   EXPECT_EQ(b21, a12);
 }
 
+TEST(MatrixTest, Dot) {
+  cpe::matrix::Matrix a(3, 1);
+  cpe::matrix::Matrix b(3, 1);
+  a[0] = 1.0;
+  a[1] = 2.0;
+  a[2] = 3.0;
+  b[0] = 4.0;
+  b[1] = -5.0;
+  b[2] = 6.0;
+  EXPECT_EQ(cpe::matrix::Dot(a, b), 12.0);
+}
+
+TEST(MatrixTest, Multiply) {
+  cpe::matrix::Matrix A(2, 3);
+  A[0, 0] = 1.0;
+  A[0, 1] = 2.0;
+  A[0, 2] = 3.0;
+  A[1, 0] = 4.0;
+  A[1, 1] = 5.0;
+  A[1, 2] = 6.0;
+  cpe::matrix::Matrix x(3, 1);
+  x[0] = 1.0;
+  x[1] = 0.0;
+  x[2] = -1.0;
+  cpe::matrix::Matrix y(2, 1);
+  cpe::matrix::Multiply(A, x, y);
+  EXPECT_EQ(y[0], -2.0);
+  EXPECT_EQ(y[1], -2.0);
+}
+
+TEST(MatrixTest, ThreadedKernels) {
+  constexpr std::size_t n = 37;
+  cpe::matrix::Matrix A(n, n);
+  cpe::matrix::Matrix x(n, 1);
+  for (std::size_t i = 0; i < n; ++i) {
+    x[i] = 1.0 + static_cast<double>(i % 5);
+    for (std::size_t j = 0; j < n; ++j) {
+      A[i, j] = static_cast<double>((3 * i + j) % 7) - 3.0;
+    }
+  }
+  cpe::matrix::Matrix y_serial(n, 1);
+  cpe::matrix::Multiply(A, x, y_serial);
+  const double dot_serial = cpe::matrix::Dot(x, y_serial);
+  for (std::size_t num_threads : {1, 2, 4}) {
+    cpe::parallel::ThreadPool pool(num_threads);
+    cpe::matrix::Matrix y(n, 1);
+    cpe::matrix::Multiply(A, x, y, pool);
+    for (std::size_t i = 0; i < n; ++i) EXPECT_EQ(y[i], y_serial[i]);
+    EXPECT_EQ(cpe::matrix::Dot(x, y, pool), dot_serial);
+  }
+}
+
+TEST(MatrixTest, DeterministicDot) {
+  constexpr std::size_t n = 10000;
+  cpe::matrix::Matrix a(n, 1);
+  cpe::matrix::Matrix b(n, 1);
+  for (std::size_t i = 0; i < n; ++i) {
+    a[i] = std::sin(static_cast<double>(i));
+    b[i] = std::exp(std::cos(static_cast<double>(3 * i)));
+  }
+  cpe::parallel::ThreadPool reference(1,
+                                      cpe::parallel::Reduction::kDeterministic);
+  const double dot = cpe::matrix::Dot(a, b, reference);
+  EXPECT_NEAR(dot, cpe::matrix::Dot(a, b), 1.0e-10 * n);
+  for (std::size_t num_threads : {2, 3, 4, 7}) {
+    cpe::parallel::ThreadPool pool(num_threads,
+                                   cpe::parallel::Reduction::kDeterministic);
+    EXPECT_EQ(cpe::matrix::Dot(a, b, pool), dot);
+  }
+}
+
 }  // namespace
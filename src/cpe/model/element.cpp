@@ -19,55 +19,133 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
+#include <cmath>
 #include <cpe/model/element.hpp>
+#include <span>
 
 namespace cpe::model {
 
-void Element::Assemble(const NodeList& nodes,
-                       std::shared_ptr<cpe::matrix::Matrix> stiffness_matrix) {
-  // TODO come up with a way of allocating these small matrices on the stack
+static const std::size_t kAreaSlot = InternAttribute("area");
 
-  // Compute stiffness assuming element is along the x-axis
-  const Node& n1 = nodes.GetNodeById(nodes_[0]);
-  const Node& n2 = nodes.GetNodeById(nodes_[1]);
-  const double length = n2.GetDistance(n1);
-  const double area = (*property_)["area"];
-  const double elastic_modulus = property_->material_->YoungsModulus();
-  const double k = area * elastic_modulus / length;
-  cpe::matrix::Matrix local_stiff(kNumNodes, kNumNodes);
-  local_stiff[0, 0] = local_stiff[1, 1] = k;
-  local_stiff[0, 1] = local_stiff[1, 0] = -k;
+Element::Section Element::GetSection(const Property& property) {
+  Section section;
+  section.area_ = property.Get(kAreaSlot);
+  section.density_ = property.material_->Density();
+  section.youngs_modulus_ = property.material_->YoungsModulus();
+  return section;
+}
 
-  // Rotate the stiffness into the correct orientation
-  const std::size_t ix1 = dof::kIx;
-  const std::size_t iy1 = dof::kIy;
-  const std::size_t iz1 = dof::kIz;
-  const std::size_t ix2 = ix1 + 3;
-  const std::size_t iy2 = iy1 + 3;
-  const std::size_t iz2 = iz1 + 3;
-  const double l = (n2.x_ - n1.x_) / length;
-  const double m = (n2.y_ - n1.y_) / length;
-  const double n = (n2.z_ - n1.z_) / length;
-  cpe::matrix::Matrix trans(kNumNodes, 3 * kNumNodes);
-  trans[0, ix1] = trans[1, ix2] = l;
-  trans[0, iy1] = trans[1, iy2] = m;
-  trans[0, iz1] = trans[1, iz2] = n;
-  cpe::matrix::Matrix stiff = trans.Transpose() * local_stiff * trans;
+void Element::Assemble(const NodeList& nodes,
+                       cpe::matrix::Matrix& stiffness_matrix) const {
+  const std::array<std::size_t, kNumDof> dof_index = GetDofIndex(nodes);
+  const std::array<double, kNumDof * kNumDof> stiff = GetStiffness(nodes);
 
   // Add contribution to the assembled stiffness matrix
-  std::array<std::size_t, 3 * kNumNodes> dof_index;
+  for (std::size_t i = 0; i < kNumDof; ++i) {
+    for (std::size_t j = 0; j < kNumDof; ++j) {
+      std::size_t di = dof_index[i];
+      std::size_t dj = dof_index[j];
+      stiffness_matrix[di, dj] += stiff[i * kNumDof + j];
+    }
+  }
+}
+
+std::array<std::size_t, Element::kNumDof> Element::GetDofIndex(
+    const NodeList& nodes) const {
+  std::array<std::size_t, kNumNodes> index;
+  nodes.GetNodeIndices(nodes_, index);
+  const auto n1 = nodes[index[0]];
+  const auto n2 = nodes[index[1]];
+  std::array<std::size_t, kNumDof> dof_index;
   dof_index[0] = n1.global_dof_index_[dof::kIx];
   dof_index[1] = n1.global_dof_index_[dof::kIy];
   dof_index[2] = n1.global_dof_index_[dof::kIz];
   dof_index[3] = n2.global_dof_index_[dof::kIx];
   dof_index[4] = n2.global_dof_index_[dof::kIy];
   dof_index[5] = n2.global_dof_index_[dof::kIz];
-  auto& global_stiff = *stiffness_matrix;
-  for (std::size_t i = 0; i < 3 * kNumNodes; ++i) {
-    for (std::size_t j = 0; j < 3 * kNumNodes; ++j) {
-      std::size_t di = dof_index[i];
-      std::size_t dj = dof_index[j];
-      global_stiff[di, dj] += stiff[i, j];
+  return dof_index;
+}
+
+std::array<double, Element::kNumDof * Element::kNumDof> Element::GetStiffness(
+    const NodeList& nodes, const Section& section) const {
+  std::array<std::size_t, kNumNodes> index;
+  nodes.GetNodeIndices(nodes_, index);
+  const auto n1 = nodes[index[0]];
+  const auto n2 = nodes[index[1]];
+  std::array<double, kNumDof * kNumDof> stiff;
+  GetStiffness<1>(section, {n2.x_ - n1.x_}, {n2.y_ - n1.y_}, {n2.z_ - n1.z_},
+                  stiff.data());
+  return stiff;
+}
+
+Element::Geometry Element::GetGeometry(
+    const NodeList& nodes, const std::array<std::size_t, kNumNodes>& index) {
+  // The same operations as the batched GetStiffness, so that a stiffness
+  // rebuilt from the geometry matches the one assembled
+  std::span<const double> x = nodes.GetX();
+  std::span<const double> y = nodes.GetY();
+  std::span<const double> z = nodes.GetZ();
+  const double dx = x[index[1]] - x[index[0]];
+  const double dy = y[index[1]] - y[index[0]];
+  const double dz = z[index[1]] - z[index[0]];
+  Geometry geometry;
+  geometry.length_ = std::sqrt(dx * dx + dy * dy + dz * dz);
+  geometry.cosines_ = {dx / geometry.length_, dy / geometry.length_,
+                       dz / geometry.length_};
+  return geometry;
+}
+
+std::array<double, Element::kNumDof * Element::kNumDof> Element::GetStiffness(
+    const Section& section, const Geometry& geometry) {
+  const double k = section.area_ * section.youngs_modulus_ / geometry.length_;
+  const std::array<double, 3>& c = geometry.cosines_;
+  std::array<double, kNumDof * kNumDof> stiff;
+  for (std::size_t i = 0; i < 3; ++i) {
+    for (std::size_t j = i; j < 3; ++j) {
+      const double value = k * c[i] * c[j];
+      stiff[i * kNumDof + j] = stiff[j * kNumDof + i] = value;
+      stiff[(i + 3) * kNumDof + j + 3] = stiff[(j + 3) * kNumDof + i + 3] =
+          value;
+      stiff[i * kNumDof + j + 3] = stiff[j * kNumDof + i + 3] = -value;
+      stiff[(i + 3) * kNumDof + j] = stiff[(j + 3) * kNumDof + i] = -value;
+    }
+  }
+  return stiff;
+}
+
+void Element::AssembleMass(const NodeList& nodes, Mass mass,
+                           cpe::matrix::Matrix& mass_matrix,
+                           const std::vector<std::size_t>* row_map) const {
+  AssembleMass(nodes, GetSection(*property_), mass, mass_matrix, row_map);
+}
+
+void Element::AssembleMass(const NodeList& nodes, const Section& section,
+                           Mass mass, cpe::matrix::Matrix& mass_matrix,
+                           const std::vector<std::size_t>* row_map) const {
+  // Axial and transverse motion carry the same translational mass, so the
+  // element mass needs no rotation
+  std::array<std::size_t, kNumNodes> index;
+  nodes.GetNodeIndices(nodes_, index);
+  const auto n1 = nodes[index[0]];
+  const auto n2 = nodes[index[1]];
+  const double length = n2.GetDistance(n1);
+  const double m = section.density_ * section.area_ * length;
+  const std::array<dof::DofIndex, 3> kTrans{dof::kIx, dof::kIy, dof::kIz};
+  for (dof::DofIndex d : kTrans) {
+    std::size_t i1 = n1.global_dof_index_[d];
+    std::size_t i2 = n2.global_dof_index_[d];
+    if (row_map) {
+      i1 = (*row_map)[i1];
+      i2 = (*row_map)[i2];
+    }
+    const bool active1 = i1 != dof::kInactiveDof;
+    const bool active2 = i2 != dof::kInactiveDof;
+    const double diagonal = mass == Mass::kLumped ? m / 2.0 : m / 3.0;
+    if (active1) mass_matrix[i1, i1] += diagonal;
+    if (active2) mass_matrix[i2, i2] += diagonal;
+    if (mass == Mass::kConsistent && active1 && active2) {
+      mass_matrix[i1, i2] += m / 6.0;
+      mass_matrix[i2, i1] += m / 6.0;
     }
   }
 }
@@ -22,21 +22,28 @@
 #pragma once
 
 #include <array>
+#include <cmath>
 #include <cpe/matrix/matrix.hpp>
 #include <cpe/model/dof.hpp>
 #include <cpe/model/nodelist.hpp>
 #include <cpe/model/property.hpp>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace cpe::model {
 
-class Element {
- private:
+// Lumped (diagonal) or consistent mass matrices
+enum class Mass { kLumped, kConsistent };
 
+// Two node truss.  Other element types need not derive from it, only meet
+// the ElementKernel concept.
+class Element {
  public:
+  static constexpr std::uint8_t kNumNodes = 2;
+  static constexpr std::size_t kNumDof = 3 * kNumNodes;
+
   Element() = delete;
-  virtual ~Element() = default;
 
   Element(std::shared_ptr<Property> property, std::size_t n1, std::size_t n2)
       : property_(property) {
@@ -44,13 +51,60 @@ class Element {
     nodes_[1] = n2;
   }
 
-  virtual void Assemble(const NodeList& nodes,
-                        std::shared_ptr<cpe::matrix::Matrix> stiffness_matrix);
+  // Property values the element kernels read, resolved once per block
+  struct Section {
+    double area_;
+    double density_;
+    double youngs_modulus_;
+  };
+  static Section GetSection(const Property& property);
+
+  void Assemble(const NodeList& nodes,
+                cpe::matrix::Matrix& stiffness_matrix) const;
+  // Adds the element mass to the rows and columns row_map gives for each
+  // global dof, when one is given, skipping dof mapped to dof::kInactiveDof
+  void AssembleMass(const NodeList& nodes, Mass mass,
+                    cpe::matrix::Matrix& mass_matrix,
+                    const std::vector<std::size_t>* row_map = nullptr) const;
+  void AssembleMass(const NodeList& nodes, const Section& section, Mass mass,
+                    cpe::matrix::Matrix& mass_matrix,
+                    const std::vector<std::size_t>* row_map = nullptr) const;
 
+  // Global dof of each row of the element stiffness
+  std::array<std::size_t, kNumDof> GetDofIndex(const NodeList& nodes) const;
   std::size_t GetNumNodes() const { return nodes_.size(); }
+  // Element stiffness in global orientation, row by row
+  std::array<double, kNumDof * kNumDof> GetStiffness(
+      const NodeList& nodes) const {
+    return GetStiffness(nodes, GetSection(*property_));
+  }
+  std::array<double, kNumDof * kNumDof> GetStiffness(
+      const NodeList& nodes, const Section& section) const;
+  // Stiffness of kLanes elements at once, from the offset of the second node
+  // of each from the first, with entry k of lane l at stiff[k * kLanes + l].
+  // Every step loops over the lanes so they can share SIMD registers.
+  template <std::size_t kLanes>
+  static void GetStiffness(const Section& section,
+                           const std::array<double, kLanes>& dx,
+                           const std::array<double, kLanes>& dy,
+                           const std::array<double, kLanes>& dz,
+                           double* stiff);
+  // Length and direction cosines, all the stiffness needs of the nodes.
+  // ElementBlock caches them to take out an element's old stiffness when
+  // its nodes move.
+  struct Geometry {
+    double length_;
+    std::array<double, 3> cosines_;
+  };
+  static Geometry GetGeometry(const NodeList& nodes,
+                              const std::array<std::size_t, kNumNodes>& index);
+  static std::array<double, kNumDof * kNumDof> GetStiffness(
+      const Section& section, const Geometry& geometry);
+  // Number of elements ElementBlock hands to the batched GetStiffness, or 1
+  // to assemble one element at a time
+  static constexpr std::size_t kBatchSize = 8;
   std::size_t operator[](std::size_t i) { return nodes_[i]; }
 
-  static constexpr std::uint8_t kNumNodes = 2;
   static constexpr std::uint8_t kVtkType = 3;  // VTK_LINE
   static constexpr std::array<std::uint8_t, kNumNodes> kVtkOrder{0, 1};
   std::array<std::size_t, kNumNodes> nodes_;
@@ -58,4 +112,48 @@ class Element {
   static dof::Dof GetSupportedDof() { return dof::kAllTrans; }
 };
 
+template <std::size_t kLanes>
+void Element::GetStiffness(const Section& section,
+                           const std::array<double, kLanes>& dx,
+                           const std::array<double, kLanes>& dy,
+                           const std::array<double, kLanes>& dz,
+                           double* stiff) {
+  // Axial stiffness k along the direction cosines c gives k c c^T blocks,
+  // which is T^T [k -k; -k k] T without forming the rotation T
+  std::array<double, kLanes> k;
+  std::array<std::array<double, kLanes>, 3> c;
+  for (std::size_t l = 0; l < kLanes; ++l) {
+    const double length =
+        std::sqrt(dx[l] * dx[l] + dy[l] * dy[l] + dz[l] * dz[l]);
+    k[l] = section.area_ * section.youngs_modulus_ / length;
+    c[0][l] = dx[l] / length;
+    c[1][l] = dy[l] / length;
+    c[2][l] = dz[l] / length;
+  }
+  // Each product is formed once and mirrored, so the stiffness is exactly
+  // symmetric
+  auto at = [stiff](std::size_t row, std::size_t column) {
+    return stiff + (row * kNumDof + column) * kLanes;
+  };
+  for (std::size_t i = 0; i < 3; ++i) {
+    for (std::size_t j = i; j < 3; ++j) {
+      double* first = at(i, j);
+      double* first_mirror = at(j, i);
+      double* second = at(i + 3, j + 3);
+      double* second_mirror = at(j + 3, i + 3);
+      double* upper = at(i, j + 3);
+      double* upper_mirror = at(j, i + 3);
+      double* lower = at(i + 3, j);
+      double* lower_mirror = at(j + 3, i);
+      for (std::size_t l = 0; l < kLanes; ++l) {
+        const double value = k[l] * c[i][l] * c[j][l];
+        first[l] = first_mirror[l] = value;
+        second[l] = second_mirror[l] = value;
+        upper[l] = upper_mirror[l] = -value;
+        lower[l] = lower_mirror[l] = -value;
+      }
+    }
+  }
+}
+
 }  // namespace cpe::model
@@ -63,7 +63,7 @@ TEST(ElementTest, AssembleXAlligned) {
 
   std::shared_ptr<cpe::matrix::Matrix> stiff =
       std::make_unique<cpe::matrix::Matrix>(6, 6);
-  element.Assemble(nodes, stiff);
+  element.Assemble(nodes, *stiff);
 
   for (std::size_t i = 0; i < 6; ++i) {
     for (std::size_t j = 0; j < 6; ++j) {
@@ -102,7 +102,7 @@ TEST(ElementTest, AssembleYAlligned) {
 
   std::shared_ptr<cpe::matrix::Matrix> stiff =
       std::make_unique<cpe::matrix::Matrix>(6, 6);
-  element.Assemble(nodes, stiff);
+  element.Assemble(nodes, *stiff);
 
   for (std::size_t i = 0; i < 6; ++i) {
     for (std::size_t j = 0; j < 6; ++j) {
@@ -141,7 +141,7 @@ TEST(ElementTest, AssembleZAlligned) {
 
   std::shared_ptr<cpe::matrix::Matrix> stiff =
       std::make_unique<cpe::matrix::Matrix>(6, 6);
-  element.Assemble(nodes, stiff);
+  element.Assemble(nodes, *stiff);
 
   for (std::size_t i = 0; i < 6; ++i) {
     for (std::size_t j = 0; j < 6; ++j) {
@@ -181,7 +181,7 @@ TEST(ElementTest, AssembleArbitrary) {
 
   std::shared_ptr<cpe::matrix::Matrix> stiff =
       std::make_unique<cpe::matrix::Matrix>(6, 6);
-  element.Assemble(nodes, stiff);
+  element.Assemble(nodes, *stiff);
 
   for (std::size_t i = 0; i < 6; ++i) {
     for (std::size_t j = 0; j < 6; ++j) {
@@ -195,4 +195,45 @@ TEST(ElementTest, AssembleArbitrary) {
   }
 }
 
+TEST(ElementTest, AssembleMass) {
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Fake material", 1000.0, 0.3,
+                                             2.0);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 10.0;
+  const double m = 2.0 * 10.0 * 5.0;
+  cpe::model::Element element(property, 1, 2);
+  cpe::model::NodeList nodes;
+  nodes.AddNode(1, 0.0, 0.0, 0.0);
+  nodes.AddNode(2, 3.0, 4.0, 0.0);
+  for (std::size_t i = 0; i < 3; ++i) {
+    nodes[0].global_dof_index_[i] = i;
+    nodes[1].global_dof_index_[i] = i + 3;
+  }
+
+  std::shared_ptr<cpe::matrix::Matrix> lumped =
+      std::make_shared<cpe::matrix::Matrix>(6, 6);
+  element.AssembleMass(nodes, cpe::model::Mass::kLumped, *lumped);
+  std::shared_ptr<cpe::matrix::Matrix> consistent =
+      std::make_shared<cpe::matrix::Matrix>(6, 6);
+  element.AssembleMass(nodes, cpe::model::Mass::kConsistent, *consistent);
+  for (std::size_t i = 0; i < 6; ++i) {
+    for (std::size_t j = 0; j < 6; ++j) {
+      const double l = (*lumped)[i, j];
+      const double c = (*consistent)[i, j];
+      if (i == j) {
+        EXPECT_DOUBLE_EQ(l, m / 2.0);
+        EXPECT_DOUBLE_EQ(c, m / 3.0);
+      } else if (i % 3 == j % 3) {
+        EXPECT_EQ(l, 0.0);
+        EXPECT_DOUBLE_EQ(c, m / 6.0);
+      } else {
+        EXPECT_EQ(l, 0.0);
+        EXPECT_EQ(c, 0.0);
+      }
+    }
+  }
+}
+
 }  // namespace
@@ -21,10 +21,16 @@
 // SOFTWARE.
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <cpe/matrix/matrix.hpp>
 #include <cpe/model/element.hpp>
+#include <cpe/model/elementtraits.hpp>
 #include <cpe/model/property.hpp>
+#include <cpe/parallel/threadpool.hpp>
 #include <memory>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -34,17 +40,37 @@ namespace cpe::model {
 class ElementBlockBase {
  public:
   virtual ~ElementBlockBase() = default;
-  virtual void Assemble(const NodeList&,
-                        std::shared_ptr<cpe::matrix::Matrix>) = 0;
+  virtual void Assemble(const NodeList&, cpe::matrix::Matrix&,
+                        cpe::parallel::ThreadPool* = nullptr) = 0;
+  virtual void Assemble(const NodeList&, const std::vector<std::size_t>&,
+                        const cpe::matrix::Matrix&, cpe::matrix::Matrix&,
+                        cpe::matrix::Matrix&,
+                        cpe::parallel::ThreadPool* = nullptr) = 0;
+  virtual void AssembleMass(const NodeList&, Mass, cpe::matrix::Matrix&,
+                            const std::vector<std::size_t>* = nullptr) = 0;
+  virtual void ResetScatter() = 0;
+  // Whether Update can bring a matrix assembled by this block up to date
+  virtual bool CanUpdate(const cpe::matrix::Matrix&, bool) const = 0;
+  virtual std::size_t Update(const NodeList&, const std::vector<bool>*,
+                             const cpe::matrix::Matrix&, cpe::matrix::Matrix&,
+                             cpe::matrix::Matrix&) = 0;
+  // Node ids of an element, in element order
+  virtual std::span<const std::size_t> GetElementNodes(std::size_t) const = 0;
   virtual std::size_t GetNumElements() const = 0;
   virtual dof::Dof GetSupportedDof() const { return dof::kAll; }
+  // VTK cell type, and the element node at each VTK cell node
+  virtual std::uint8_t GetVtkType() const = 0;
+  virtual std::span<const std::uint8_t> GetVtkOrder() const = 0;
   virtual void Reserve(std::size_t) = 0;
-  virtual Element& operator[](std::size_t) = 0;
 };
 
-template <typename T>
+// Elements of one type, dispatched once per block.  Everything per element
+// is resolved at compile time through ElementTraits.
+template <ElementKernel T>
 class ElementBlock : public ElementBlockBase {
  public:
+  using Traits = ElementTraits<T>;
+
   ElementBlock() = delete;
   ElementBlock(const ElementBlock&) = delete;
   ElementBlock(ElementBlock&&) = delete;
@@ -61,23 +87,309 @@ class ElementBlock : public ElementBlockBase {
   void AddElement(Args&&... args) {
     elements_.emplace_back(property_, std::forward<Args>(args)...);
   }
-  void Assemble(const NodeList& nodes,
-                std::shared_ptr<cpe::matrix::Matrix> stiffness_matrix) {
+  // Scatters each element stiffness through the slot map, one color at a
+  // time with the elements of a color spread over pool when one is given.
+  // The slot map and colors are built on the first call and again whenever
+  // the elements, the matrix width or the kind of assembly change, or after
+  // ResetScatter.  Contributions are added in the same order whatever the
+  // number of threads.
+  void Assemble(const NodeList& nodes, cpe::matrix::Matrix& stiffness_matrix,
+                cpe::parallel::ThreadPool* pool = nullptr) {
+    if (!IsScatterValid(stiffness_matrix, false)) {
+      BuildScatter(nodes, stiffness_matrix.GetNumColumns());
+      BuildColors(nodes);
+    }
+    Scatter(nodes, nullptr, stiffness_matrix, nullptr, pool);
+    CacheGeometry(nodes);
+  }
+  // As Assemble, into the rows and columns of stiffness_matrix given by
+  // row_map for each global dof.  Couplings to a dof mapped to
+  // dof::kInactiveDof are moved to the right hand side instead, subtracting
+  // their product with the prescribed value from force, both indexed by
+  // global dof.
+  void Assemble(const NodeList& nodes, const std::vector<std::size_t>& row_map,
+                const cpe::matrix::Matrix& prescribed,
+                cpe::matrix::Matrix& stiffness_matrix,
+                cpe::matrix::Matrix& force,
+                cpe::parallel::ThreadPool* pool = nullptr) {
+    if (!IsScatterValid(stiffness_matrix, true)) {
+      BuildScatter(nodes, stiffness_matrix.GetNumColumns(), &row_map);
+      BuildColors(nodes);
+    }
+    Scatter(nodes, &prescribed, stiffness_matrix, &force, pool);
+    CacheGeometry(nodes);
+  }
+  void AssembleMass(const NodeList& nodes, Mass mass,
+                    cpe::matrix::Matrix& mass_matrix,
+                    const std::vector<std::size_t>* row_map = nullptr) {
+    const typename Traits::Section section = T::GetSection(*property_);
     for (std::size_t i = 0; i < GetNumElements(); ++i) {
-      elements_[i].Assemble(nodes, stiffness_matrix);
+      elements_[i].AssembleMass(nodes, section, mass, mass_matrix, row_map);
     }
   }
   std::size_t Capacity() { return elements_.capacity(); }
+  std::span<const std::size_t> GetElementNodes(std::size_t i) const {
+    return elements_[i].nodes_;
+  }
   std::size_t GetNumElements() const { return elements_.size(); }
   dof::Dof GetSupportedDof() const { return T::GetSupportedDof(); }
+  std::uint8_t GetVtkType() const { return T::kVtkType; }
+  std::span<const std::uint8_t> GetVtkOrder() const { return T::kVtkOrder; }
   T& operator[](std::size_t i) { return elements_[i]; }
   void Reserve(std::size_t c) { elements_.reserve(c); }
 
+  // Flat offset in a matrix with num_columns columns of every entry of every
+  // element stiffness, in GetStiffness order.  With a row map, entries in a
+  // row or column mapped to dof::kInactiveDof get the slot dof::kInactiveDof,
+  // and those coupling a mapped row to an unmapped column are listed in
+  // couplings_ as well.
+  void BuildScatter(const NodeList& nodes, std::size_t num_columns,
+                    const std::vector<std::size_t>* row_map = nullptr) {
+    constexpr std::size_t kNumDof = Traits::kNumDof;
+    slots_.resize(Traits::kStiffnessSize * GetNumElements());
+    couplings_.clear();
+    coupling_offsets_.assign(1, 0);
+    node_index_.resize(GetNumElements());
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < GetNumElements(); ++i) {
+      nodes.GetNodeIndices(elements_[i].nodes_, node_index_[i]);
+      const auto dof_index = elements_[i].GetDofIndex(nodes);
+      typename Traits::DofIndex rows = dof_index;
+      if (row_map) {
+        for (std::size_t& row : rows) row = (*row_map)[row];
+      }
+      for (std::size_t r = 0; r < kNumDof; ++r) {
+        for (std::size_t c = 0; c < kNumDof; ++c, ++k) {
+          if (rows[r] == dof::kInactiveDof || rows[c] == dof::kInactiveDof) {
+            slots_[k] = dof::kInactiveDof;
+            if (rows[r] != dof::kInactiveDof) {
+              couplings_.push_back(
+                  {r * kNumDof + c, dof_index[r], dof_index[c]});
+            }
+          } else {
+            slots_[k] = rows[r] * num_columns + rows[c];
+          }
+        }
+      }
+      coupling_offsets_.push_back(couplings_.size());
+    }
+    // Elements on each node, for updating after nodes move
+    node_element_offsets_.assign(nodes.GetNumNodes() + 1, 0);
+    for (const auto& index : node_index_) {
+      for (std::size_t node : index) node_element_offsets_[node + 1]++;
+    }
+    for (std::size_t n = 0; n < nodes.GetNumNodes(); ++n) {
+      node_element_offsets_[n + 1] += node_element_offsets_[n];
+    }
+    node_elements_.resize(node_element_offsets_.back());
+    std::vector<std::size_t> next(node_element_offsets_.begin(),
+                                  node_element_offsets_.end() - 1);
+    for (std::size_t i = 0; i < GetNumElements(); ++i) {
+      for (std::size_t node : node_index_[i]) node_elements_[next[node]++] = i;
+    }
+    num_columns_ = num_columns;
+    reduced_ = row_map != nullptr;
+  }
+  void ResetScatter() { slots_.clear(); }
+
+  bool CanUpdate(const cpe::matrix::Matrix& stiffness_matrix,
+                 bool reduced) const {
+    return Traits::kIncremental && IsScatterValid(stiffness_matrix, reduced) &&
+           geometry_.size() == GetNumElements();
+  }
+  // Adds the change in stiffness since the last Assemble or Update of the
+  // elements on the nodes moved since, or of every element when the
+  // property may have changed.  The old stiffness is rebuilt from the cached
+  // geometry and section.  Couplings to prescribed dof go to force as in
+  // Assemble; for a full system, fixed marks the constrained rows, which are
+  // left alone, with couplings to them going to force as well.  Needs
+  // CanUpdate, and returns the number of elements updated.
+  std::size_t Update(const NodeList& nodes, const std::vector<bool>* fixed,
+                     const cpe::matrix::Matrix& prescribed,
+                     cpe::matrix::Matrix& stiffness_matrix,
+                     cpe::matrix::Matrix& force) {
+    if constexpr (Traits::kIncremental) {
+      const typename Traits::Section section = T::GetSection(*property_);
+      std::vector<std::size_t> changed;
+      if (property_->GetVersion() != property_version_) {
+        for (std::size_t e = 0; e < GetNumElements(); ++e) {
+          changed.push_back(e);
+        }
+      } else {
+        for (std::size_t node : nodes.GetMovedNodes()) {
+          if (node + 1 >= node_element_offsets_.size()) continue;
+          for (std::size_t k = node_element_offsets_[node];
+               k < node_element_offsets_[node + 1]; ++k) {
+            changed.push_back(node_elements_[k]);
+          }
+        }
+        std::sort(changed.begin(), changed.end());
+        changed.erase(std::unique(changed.begin(), changed.end()),
+                      changed.end());
+      }
+      for (std::size_t e : changed) {
+        const typename Traits::Stiffness old_stiff =
+            T::GetStiffness(section_, geometry_[e]);
+        geometry_[e] = T::GetGeometry(nodes, node_index_[e]);
+        typename Traits::Stiffness stiff =
+            T::GetStiffness(section, geometry_[e]);
+        for (std::size_t k = 0; k < kSize; ++k) stiff[k] -= old_stiff[k];
+        Add(e, stiff.data(), 1, &prescribed, fixed, stiffness_matrix, &force);
+      }
+      section_ = section;
+      property_version_ = property_->GetVersion();
+      return changed.size();
+    } else {
+      return 0;
+    }
+  }
+  const std::vector<std::size_t>& GetScatter() const { return slots_; }
+
+  // Greedy coloring in element order: each element takes the lowest color not
+  // already used by an element on one of its nodes
+  void BuildColors(const NodeList& nodes) {
+    colors_.clear();
+    std::vector<std::vector<std::size_t> > node_colors(nodes.GetNumNodes());
+    std::vector<bool> used;
+    for (std::size_t i = 0; i < GetNumElements(); ++i) {
+      typename Traits::NodeIndex index;
+      nodes.GetNodeIndices(elements_[i].nodes_, index);
+      used.assign(colors_.size() + 1, false);
+      for (std::size_t node : index) {
+        for (std::size_t c : node_colors[node]) used[c] = true;
+      }
+      const std::size_t color =
+          std::find(used.begin(), used.end(), false) - used.begin();
+      if (color == colors_.size()) colors_.emplace_back();
+      colors_[color].push_back(i);
+      for (std::size_t node : index) node_colors[node].push_back(color);
+    }
+  }
+  const std::vector<std::vector<std::size_t> >& GetColors() const {
+    return colors_;
+  }
+
   const std::string name_;
   const std::shared_ptr<Property> property_;
 
  private:
+  static constexpr std::size_t kBatch = Traits::kBatchSize;
+  static constexpr std::size_t kSize = Traits::kStiffnessSize;
+
+  // Entry of an element stiffness coupling a free row to a prescribed column
+  struct Coupling {
+    std::size_t entry_;
+    std::size_t row_;
+    std::size_t column_;
+  };
+
+  bool IsScatterValid(const cpe::matrix::Matrix& matrix, bool reduced) const {
+    return slots_.size() == Traits::kStiffnessSize * GetNumElements() &&
+           num_columns_ == matrix.GetNumColumns() && reduced_ == reduced;
+  }
+
+  // Adds the stiffness of element e, entry k at stiff[k * stride], through
+  // its slots, and its couplings to prescribed dof to force when one is given
+  void Add(std::size_t e, const double* stiff, std::size_t stride,
+           const cpe::matrix::Matrix* prescribed,
+           const std::vector<bool>* fixed,
+           cpe::matrix::Matrix& stiffness_matrix, cpe::matrix::Matrix* force) {
+    const std::size_t* slot = slots_.data() + kSize * e;
+    for (std::size_t k = 0; k < kSize; ++k) {
+      if (slot[k] == dof::kInactiveDof) continue;
+      if (fixed) {
+        const std::size_t row = slot[k] / num_columns_;
+        const std::size_t column = slot[k] % num_columns_;
+        if ((*fixed)[row]) continue;
+        if ((*fixed)[column]) {
+          (*force)[row] -= stiff[k * stride] * (*prescribed)[column];
+          continue;
+        }
+      }
+      stiffness_matrix[slot[k]] += stiff[k * stride];
+    }
+    if (!force) return;
+    for (std::size_t c = coupling_offsets_[e]; c < coupling_offsets_[e + 1];
+         ++c) {
+      const Coupling& coupling = couplings_[c];
+      (*force)[coupling.row_] -=
+          stiff[coupling.entry_ * stride] * (*prescribed)[coupling.column_];
+    }
+  }
+
+  void CacheGeometry(const NodeList& nodes) {
+    if constexpr (Traits::kIncremental) {
+      geometry_.resize(GetNumElements());
+      for (std::size_t e = 0; e < GetNumElements(); ++e) {
+        geometry_[e] = T::GetGeometry(nodes, node_index_[e]);
+      }
+      section_ = T::GetSection(*property_);
+      property_version_ = property_->GetVersion();
+    }
+  }
+
+  // Elements of a color are handed to the batched stiffness kernel
+  // T::kBatchSize at a time, with the last batch padded by repeating its
+  // final element
+  void Scatter(const NodeList& nodes, const cpe::matrix::Matrix* prescribed,
+               cpe::matrix::Matrix& stiffness_matrix,
+               cpe::matrix::Matrix* force, cpe::parallel::ThreadPool* pool) {
+    cpe::parallel::ThreadPool serial(1);
+    cpe::parallel::ThreadPool& threads = pool ? *pool : serial;
+    const typename Traits::Section section = T::GetSection(*property_);
+    for (const std::vector<std::size_t>& color : colors_) {
+      threads.ParallelFor(
+          color.size(), [&](std::size_t begin, std::size_t end) {
+            if constexpr (kBatch > 1) {
+              std::span<const double> x = nodes.GetX();
+              std::span<const double> y = nodes.GetY();
+              std::span<const double> z = nodes.GetZ();
+              std::array<double, kBatch> dx;
+              std::array<double, kBatch> dy;
+              std::array<double, kBatch> dz;
+              std::array<double, kSize * kBatch> stiff;
+              for (std::size_t i = begin; i < end; i += kBatch) {
+                const std::size_t count = std::min(kBatch, end - i);
+                for (std::size_t l = 0; l < kBatch; ++l) {
+                  const std::size_t e = color[i + std::min(l, count - 1)];
+                  const auto& index = node_index_[e];
+                  dx[l] = x[index[1]] - x[index[0]];
+                  dy[l] = y[index[1]] - y[index[0]];
+                  dz[l] = z[index[1]] - z[index[0]];
+                }
+                T::template GetStiffness<kBatch>(section, dx, dy, dz,
+                                                 stiff.data());
+                for (std::size_t l = 0; l < count; ++l) {
+                  Add(color[i + l], stiff.data() + l, kBatch, prescribed,
+                      nullptr, stiffness_matrix, force);
+                }
+              }
+            } else {
+              for (std::size_t i = begin; i < end; ++i) {
+                const std::size_t e = color[i];
+                const typename Traits::Stiffness stiff =
+                    elements_[e].GetStiffness(nodes, section);
+                Add(e, stiff.data(), 1, prescribed, nullptr, stiffness_matrix,
+                    force);
+              }
+            }
+          });
+    }
+  }
+
+  std::vector<std::vector<std::size_t> > colors_;
+  std::vector<std::size_t> coupling_offsets_;
+  std::vector<Coupling> couplings_;
   std::vector<T> elements_;
+  std::vector<typename Traits::Geometry> geometry_;
+  std::vector<std::size_t> node_element_offsets_;
+  std::vector<std::size_t> node_elements_;
+  std::vector<typename Traits::NodeIndex> node_index_;
+  std::size_t property_version_ = 0;
+  typename Traits::Section section_{};
+  std::size_t num_columns_ = 0;
+  bool reduced_ = false;
+  std::vector<std::size_t> slots_;
 };
 
 }  // namespace cpe::model
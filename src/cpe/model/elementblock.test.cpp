@@ -21,10 +21,13 @@
 // SOFTWARE.
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <cpe/model/element.hpp>
 #include <cpe/model/elementblock.hpp>
 #include <cpe/model/material.hpp>
 #include <cpe/model/property.hpp>
+#include <cpe/parallel/threadpool.hpp>
+#include <set>
 
 namespace {
 
@@ -33,12 +36,14 @@ class TestElement : public cpe::model::Element {
   TestElement(std::shared_ptr<cpe::model::Property> property, std::size_t n1,
               std::size_t n2)
       : cpe::model::Element(property, n1, n2) {};
-  void Assemble(const cpe::model::NodeList& nodes,
-                std::shared_ptr<cpe::matrix::Matrix> stiffness_matrix) {
-    const cpe::model::Node& n1 = nodes.GetNodeById(nodes_[0]);
-    const cpe::model::Node& n2 = nodes.GetNodeById(nodes_[1]);
-    std::array<std::size_t, cpe::model::dof::kNumStrucDof * kNumNodes>
-        dof_index;
+  static constexpr std::size_t kNumDof =
+      cpe::model::dof::kNumStrucDof * kNumNodes;
+  static constexpr std::size_t kBatchSize = 1;
+  std::array<std::size_t, kNumDof> GetDofIndex(
+      const cpe::model::NodeList& nodes) const {
+    const auto n1 = nodes.GetNodeById(nodes_[0]);
+    const auto n2 = nodes.GetNodeById(nodes_[1]);
+    std::array<std::size_t, kNumDof> dof_index;
     dof_index[0] = n1.global_dof_index_[cpe::model::dof::kIx];
     dof_index[1] = n1.global_dof_index_[cpe::model::dof::kIy];
     dof_index[2] = n1.global_dof_index_[cpe::model::dof::kIz];
@@ -51,14 +56,13 @@ class TestElement : public cpe::model::Element {
     dof_index[9] = n2.global_dof_index_[cpe::model::dof::kIdx];
     dof_index[10] = n2.global_dof_index_[cpe::model::dof::kIdy];
     dof_index[11] = n2.global_dof_index_[cpe::model::dof::kIdz];
-    auto& global_stiff = *stiffness_matrix;
-    for (std::size_t i = 0; i < dof_index.size(); ++i) {
-      for (std::size_t j = 0; j < dof_index.size(); ++j) {
-        std::size_t di = dof_index[i];
-        std::size_t dj = dof_index[j];
-        global_stiff[di, dj] += 1.0;
-      }
-    }
+    return dof_index;
+  }
+  std::array<double, kNumDof * kNumDof> GetStiffness(
+      const cpe::model::NodeList&, const Section&) const {
+    std::array<double, kNumDof * kNumDof> stiff;
+    stiff.fill(1.0);
+    return stiff;
   }
   static cpe::model::dof::Dof GetSupportedDof() {
     return cpe::model::dof::kAll;
@@ -124,7 +128,131 @@ TEST(PropertyTest, Assemble) {
   std::shared_ptr<cpe::matrix::Matrix> stiff =
       std::make_shared<cpe::matrix::Matrix>(kNumNodes * kNumDof,
                                             kNumNodes * kNumDof);
-  block.Assemble(nodes, stiff);
+  block.Assemble(nodes, *stiff);
+  EXPECT_EQ(block.GetScatter().size(), 2 * 12 * 12);
+  block.Assemble(nodes, *stiff);
+  for (std::size_t i = 0; i < kNumNodes * kNumDof; ++i) {
+    for (std::size_t j = 0; j < kNumNodes * kNumDof; ++j) {
+      const double value = (*stiff)[i, j];
+      const std::size_t ni = i / kNumDof;
+      const std::size_t nj = j / kNumDof;
+      if (ni == 1 && nj == 1) {
+        EXPECT_EQ(value, 4.0);
+      } else if (ni == nj || ni + nj == 1 || ni + nj == 3) {
+        EXPECT_EQ(value, 2.0);
+      } else {
+        EXPECT_EQ(value, 0.0);
+      }
+    }
+  }
+}
+
+TEST(PropertyTest, AssembleMatchesElements) {
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("a", 1000.0, 0.3);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("property", material);
+  (*property)["area"] = 2.0;
+  cpe::model::ElementBlock<cpe::model::Element> block("elements", property);
+  block.AddElement(1, 2);
+  block.AddElement(2, 3);
+  block.AddElement(3, 1);
+  cpe::model::NodeList nodes(3);
+  nodes.AddNode(1, 0.0, 0.0, 0.0);
+  nodes.AddNode(2, 3.0, 0.0, 1.0);
+  nodes.AddNode(3, 1.0, 4.0, 2.0);
+  for (std::size_t i = 0; i < 3; ++i) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      nodes[i].global_dof_index_[j] = 3 * (2 - i) + j;
+    }
+  }
+  cpe::matrix::Matrix scattered(9, 9);
+  block.Assemble(nodes, scattered);
+  cpe::matrix::Matrix expected(9, 9);
+  for (std::size_t i = 0; i < block.GetNumElements(); ++i) {
+    block[i].Assemble(nodes, expected);
+  }
+  for (std::size_t i = 0; i < 9 * 9; ++i) {
+    EXPECT_DOUBLE_EQ(scattered[i], expected[i]);
+  }
+}
+
+TEST(PropertyTest, AssembleBatches) {
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("a", 1000.0, 0.3);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("property", material);
+  (*property)["area"] = 2.0;
+  cpe::model::ElementBlock<cpe::model::Element> block("elements", property);
+  // Braced helix, whose colors hold whole batches and a partial one
+  const std::size_t n = 20;
+  cpe::model::NodeList nodes(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    nodes.AddNode(i, std::cos(0.7 * i), std::sin(0.7 * i), 0.3 * i);
+    for (std::size_t d = 0; d < 3; ++d) {
+      nodes[i].global_dof_index_[d] = 3 * i + d;
+    }
+    if (i + 1 < n) block.AddElement(i, i + 1);
+    if (i + 2 < n) block.AddElement(i, i + 2);
+  }
+  cpe::matrix::Matrix batched(3 * n, 3 * n);
+  block.Assemble(nodes, batched);
+  cpe::matrix::Matrix expected(3 * n, 3 * n);
+  for (std::size_t i = 0; i < block.GetNumElements(); ++i) {
+    block[i].Assemble(nodes, expected);
+  }
+  for (std::size_t i = 0; i < 9 * n * n; ++i) {
+    EXPECT_NEAR(batched[i], expected[i], 1.0e-12 * 1000.0 * 2.0);
+  }
+}
+
+TEST(PropertyTest, AssembleColors) {
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("a", 1000.0, 0.3);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("property", material);
+  (*property)["area"] = 2.0;
+  cpe::model::ElementBlock<cpe::model::Element> block("elements", property);
+  // Braced grid of n by n nodes, with up to eight elements on each node
+  const std::size_t n = 12;
+  cpe::model::NodeList nodes(n * n);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      const std::size_t id = i * n + j;
+      nodes.AddNode(id, 1.0 * j, 1.0 * i, 0.1 * ((i + j) % 3));
+      for (std::size_t d = 0; d < 3; ++d) {
+        nodes[id].global_dof_index_[d] = 3 * id + d;
+      }
+      if (j + 1 < n) block.AddElement(id, id + 1);
+      if (i + 1 < n) block.AddElement(id, id + n);
+      if (i + 1 < n && j + 1 < n) block.AddElement(id, id + n + 1);
+      if (i + 1 < n && j > 0) block.AddElement(id, id + n - 1);
+    }
+  }
+
+  cpe::matrix::Matrix serial(3 * n * n, 3 * n * n);
+  block.Assemble(nodes, serial);
+  const auto& colors = block.GetColors();
+  EXPECT_LE(colors.size(), 16);
+  std::size_t num_colored = 0;
+  for (const std::vector<std::size_t>& color : colors) {
+    std::set<std::size_t> color_nodes;
+    for (std::size_t e : color) {
+      EXPECT_TRUE(color_nodes.insert(block[e][0]).second);
+      EXPECT_TRUE(color_nodes.insert(block[e][1]).second);
+    }
+    num_colored += color.size();
+  }
+  EXPECT_EQ(num_colored, block.GetNumElements());
+
+  for (std::size_t num_threads : {2, 3, 4}) {
+    cpe::parallel::ThreadPool pool(num_threads);
+    cpe::matrix::Matrix threaded(3 * n * n, 3 * n * n);
+    block.Assemble(nodes, threaded, &pool);
+    for (std::size_t i = 0; i < 9 * n * n * n * n; ++i) {
+      EXPECT_EQ(threaded[i], serial[i]);
+    }
+  }
 }
 
 }  // namespace
@@ -0,0 +1,104 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cpe/matrix/matrix.hpp>
+#include <cpe/model/dof.hpp>
+#include <cpe/model/element.hpp>
+#include <cpe/model/nodelist.hpp>
+#include <cpe/model/property.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cpe::model {
+
+// What ElementBlock needs from an element type, all of it resolved at
+// compile time: its node and dof counts, the dof it supports, how its
+// property is resolved to a Section and the signatures of its kernels.
+template <typename T>
+concept ElementKernel = requires(const T& element, const NodeList& nodes,
+                                 const Property& property,
+                                 const typename T::Section& section,
+                                 cpe::matrix::Matrix& matrix,
+                                 const std::vector<std::size_t>* row_map) {
+  { T::kNumNodes } -> std::convertible_to<std::size_t>;
+  { T::kNumDof } -> std::convertible_to<std::size_t>;
+  { T::kBatchSize } -> std::convertible_to<std::size_t>;
+  { T::kVtkType } -> std::convertible_to<std::uint8_t>;
+  {
+    T::kVtkOrder
+  } -> std::convertible_to<std::array<std::uint8_t, T::kNumNodes> >;
+  { T::GetSupportedDof() } -> std::same_as<dof::Dof>;
+  { T::GetSection(property) } -> std::same_as<typename T::Section>;
+  {
+    element.nodes_
+  } -> std::convertible_to<std::array<std::size_t, T::kNumNodes> >;
+  {
+    element.GetDofIndex(nodes)
+  } -> std::same_as<std::array<std::size_t, T::kNumDof> >;
+  {
+    element.GetStiffness(nodes, section)
+  } -> std::same_as<std::array<double, T::kNumDof * T::kNumDof> >;
+  element.AssembleMass(nodes, section, Mass::kLumped, matrix, row_map);
+};
+
+// Cached geometry of an element type, empty when it has none
+template <typename T>
+struct ElementGeometry {
+  struct type {};
+};
+template <typename T>
+  requires requires { typename T::Geometry; }
+struct ElementGeometry<T> {
+  using type = typename T::Geometry;
+};
+
+// Sizes and buffer types of an element type, for local storage sized at
+// compile time
+template <ElementKernel T>
+struct ElementTraits {
+  static constexpr std::size_t kNumNodes = T::kNumNodes;
+  static constexpr std::size_t kNumDof = T::kNumDof;
+  static constexpr std::size_t kStiffnessSize = kNumDof * kNumDof;
+  static constexpr std::size_t kBatchSize = T::kBatchSize;
+
+  using DofIndex = std::array<std::size_t, kNumDof>;
+  using Geometry = typename ElementGeometry<T>::type;
+  using NodeIndex = std::array<std::size_t, kNumNodes>;
+  using Section = typename T::Section;
+  using Stiffness = std::array<double, kStiffnessSize>;
+
+  // Whether the stiffness can be rebuilt from a cached T::Geometry, which
+  // lets ElementBlock update only the elements on moved nodes
+  static constexpr bool kIncremental = requires(const NodeList& nodes,
+                                                const NodeIndex& index,
+                                                const Section& section) {
+    {
+      T::GetStiffness(section, T::GetGeometry(nodes, index))
+    } -> std::same_as<Stiffness>;
+  };
+};
+
+}  // namespace cpe::model
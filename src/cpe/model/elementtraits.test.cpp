@@ -0,0 +1,120 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cpe/matrix/matrix.hpp>
+#include <cpe/model/elementblock.hpp>
+#include <cpe/model/elementtraits.hpp>
+#include <cpe/model/material.hpp>
+#include <cpe/model/nodelist.hpp>
+#include <cpe/model/property.hpp>
+#include <memory>
+#include <vector>
+
+namespace {
+
+// Spring from one node to ground, unrelated to Element
+class GroundSpring {
+ public:
+  static constexpr std::size_t kNumNodes = 1;
+  static constexpr std::size_t kNumDof = 3;
+  static constexpr std::size_t kBatchSize = 1;
+  static constexpr std::uint8_t kVtkType = 1;  // VTK_VERTEX
+  static constexpr std::array<std::uint8_t, kNumNodes> kVtkOrder{0};
+
+  struct Section {
+    double stiffness_;
+  };
+
+  GroundSpring(std::shared_ptr<cpe::model::Property>, std::size_t n)
+      : nodes_{n} {}
+
+  static cpe::model::dof::Dof GetSupportedDof() {
+    return cpe::model::dof::kAllTrans;
+  }
+  static Section GetSection(const cpe::model::Property& property) {
+    return {property.Get(cpe::model::InternAttribute("stiffness"))};
+  }
+  std::array<std::size_t, kNumDof> GetDofIndex(
+      const cpe::model::NodeList& nodes) const {
+    const auto node = nodes.GetNodeById(nodes_[0]);
+    return {node.global_dof_index_[0], node.global_dof_index_[1],
+            node.global_dof_index_[2]};
+  }
+  std::array<double, kNumDof * kNumDof> GetStiffness(
+      const cpe::model::NodeList&, const Section& section) const {
+    std::array<double, kNumDof * kNumDof> stiff{};
+    for (std::size_t i = 0; i < kNumDof; ++i) {
+      stiff[i * kNumDof + i] = section.stiffness_;
+    }
+    return stiff;
+  }
+  void AssembleMass(const cpe::model::NodeList&, const Section&,
+                    cpe::model::Mass, cpe::matrix::Matrix&,
+                    const std::vector<std::size_t>*) const {}
+
+  std::array<std::size_t, kNumNodes> nodes_;
+};
+
+TEST(ElementTraitsTest, Sizes) {
+  using Traits = cpe::model::ElementTraits<cpe::model::Element>;
+  static_assert(Traits::kNumNodes == 2);
+  static_assert(Traits::kNumDof == 6);
+  static_assert(std::tuple_size_v<Traits::Stiffness> == 36);
+  static_assert(cpe::model::ElementKernel<GroundSpring>);
+  static_assert(!cpe::model::ElementKernel<cpe::model::Property>);
+  EXPECT_EQ(cpe::model::ElementTraits<GroundSpring>::kStiffnessSize, 9);
+}
+
+TEST(ElementTraitsTest, Block) {
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("a", 1.0, 0.1);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("spring", material);
+  (*property)["stiffness"] = 4.0;
+  cpe::model::ElementBlock<GroundSpring> block("springs", property);
+  block.AddElement(7);
+  block.AddElement(3);
+  cpe::model::NodeList nodes;
+  nodes.AddNode(3, 0.0);
+  nodes.AddNode(7, 1.0);
+  for (std::size_t i = 0; i < 2; ++i) {
+    for (std::size_t d = 0; d < 3; ++d) {
+      nodes[i].global_dof_index_[d] = 3 * i + d;
+    }
+  }
+  cpe::matrix::Matrix stiff(6, 6);
+  block.Assemble(nodes, stiff);
+  for (std::size_t i = 0; i < 6; ++i) {
+    for (std::size_t j = 0; j < 6; ++j) {
+      const double value = stiff[i, j];
+      EXPECT_EQ(value, i == j ? 4.0 : 0.0);
+    }
+  }
+  const cpe::model::ElementBlockBase& base = block;
+  EXPECT_EQ(base.GetElementNodes(0)[0], 7);
+  EXPECT_EQ(base.GetVtkType(), 1);
+  EXPECT_EQ(base.GetVtkOrder().size(), 1);
+}
+
+}  // namespace
@@ -0,0 +1,147 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace cpe::model {
+
+// Map from ids to indices.  While the ids span a range of at most about twice
+// their number it is a table indexed directly by id, and otherwise an open
+// addressing hash table with linear probing.  Either way a lookup touches one
+// or a few adjacent entries.
+class IdMap {
+ public:
+  static constexpr std::size_t kNotFound =
+      std::numeric_limits<std::size_t>::max();
+
+  // Index of id, or kNotFound
+  std::size_t Find(std::size_t id) const {
+    if (dense_) {
+      const std::size_t k = id - offset_;
+      return k < values_.size() ? values_[k] : kNotFound;
+    }
+    if (values_.empty()) return kNotFound;
+    const std::size_t mask = values_.size() - 1;
+    for (std::size_t slot = Hash(id) & mask;; slot = (slot + 1) & mask) {
+      if (values_[slot] == kNotFound) return kNotFound;
+      if (keys_[slot] == id) return values_[slot];
+    }
+  }
+
+  // Index of each of ids, or kNotFound, into indices
+  void Find(const std::size_t* ids, std::size_t n, std::size_t* indices) const {
+    if (dense_) {
+      for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t k = ids[i] - offset_;
+        indices[i] = k < values_.size() ? values_[k] : kNotFound;
+      }
+    } else {
+      for (std::size_t i = 0; i < n; ++i) indices[i] = Find(ids[i]);
+    }
+  }
+
+  // Adds id, returning false without changing anything if it is already there
+  bool Insert(std::size_t id, std::size_t index) {
+    if (Find(id) != kNotFound) return false;
+    min_id_ = size_ == 0 ? id : std::min(min_id_, id);
+    max_id_ = size_ == 0 ? id : std::max(max_id_, id);
+    size_++;
+    if (IsCompact()) {
+      if (!dense_ || id < offset_ || id - offset_ >= values_.size()) {
+        Rebuild(true);
+      }
+      values_[id - offset_] = index;
+    } else {
+      if (dense_ || 2 * size_ > values_.size()) Rebuild(false);
+      Place(id, index);
+    }
+    return true;
+  }
+
+  bool IsDense() const { return dense_; }
+  std::size_t GetSize() const { return size_; }
+
+ private:
+  static std::size_t Hash(std::size_t id) {
+    const std::uint64_t h = static_cast<std::uint64_t>(id) *
+                            UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<std::size_t>(h ^ (h >> 32));
+  }
+
+  bool IsCompact() const {
+    return max_id_ - min_id_ < 2 * size_ + kDenseSlack;
+  }
+
+  void Place(std::size_t id, std::size_t index) {
+    const std::size_t mask = values_.size() - 1;
+    std::size_t slot = Hash(id) & mask;
+    while (values_[slot] != kNotFound) slot = (slot + 1) & mask;
+    keys_[slot] = id;
+    values_[slot] = index;
+  }
+
+  // Moves every entry into a new dense table with room to grow on either
+  // side, or into a new hash table at most half full
+  void Rebuild(bool dense) {
+    std::vector<std::pair<std::size_t, std::size_t> > entries;
+    entries.reserve(size_);
+    for (std::size_t k = 0; k < values_.size(); ++k) {
+      if (values_[k] == kNotFound) continue;
+      entries.emplace_back(dense_ ? offset_ + k : keys_[k], values_[k]);
+    }
+    const std::size_t old_size = values_.size();
+    keys_.clear();
+    values_.clear();
+    dense_ = dense;
+    if (dense) {
+      const std::size_t range = max_id_ - min_id_ + 1;
+      const std::size_t size = std::max(range, 2 * old_size);
+      const std::size_t room = size - range;
+      offset_ = min_id_ - std::min(min_id_, room / 2);
+      values_.assign(size, kNotFound);
+      for (const auto& [id, index] : entries) values_[id - offset_] = index;
+    } else {
+      std::size_t size = 16;
+      while (size < 4 * size_) size *= 2;
+      keys_.assign(size, 0);
+      values_.assign(size, kNotFound);
+      for (const auto& [id, index] : entries) Place(id, index);
+    }
+  }
+
+  static constexpr std::size_t kDenseSlack = 64;
+
+  bool dense_ = true;
+  std::vector<std::size_t> keys_;
+  std::size_t max_id_ = 0;
+  std::size_t min_id_ = 0;
+  std::size_t offset_ = 0;
+  std::size_t size_ = 0;
+  std::vector<std::size_t> values_;
+};
+
+}  // namespace cpe::model
@@ -0,0 +1,83 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cpe/model/idmap.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+
+TEST(IdMapTest, Dense) {
+  // Ids in a compact range, added out of order and from a large offset
+  const std::size_t offset = 1000000;
+  const std::size_t n = 1000;
+  cpe::model::IdMap map;
+  EXPECT_EQ(map.Find(offset), cpe::model::IdMap::kNotFound);
+  for (std::size_t i = 0; i < n; ++i) {
+    const std::size_t id = offset + (i % 2 == 0 ? n - i : i);
+    EXPECT_TRUE(map.Insert(id, i));
+  }
+  EXPECT_TRUE(map.IsDense());
+  EXPECT_EQ(map.GetSize(), n);
+  EXPECT_FALSE(map.Insert(offset + 1, 0));
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(map.Find(offset + (i % 2 == 0 ? n - i : i)), i);
+  }
+  EXPECT_EQ(map.Find(offset + n + 1), cpe::model::IdMap::kNotFound);
+  EXPECT_EQ(map.Find(0), cpe::model::IdMap::kNotFound);
+}
+
+TEST(IdMapTest, Sparse) {
+  // Ids spread far apart, which switch it to hashing, then packed closely
+  // enough to switch back
+  const std::size_t n = 5000;
+  std::mt19937_64 generator(5489u);
+  std::vector<std::size_t> ids;
+  cpe::model::IdMap map;
+  for (std::size_t i = 0; i < n; ++i) {
+    std::size_t id = generator();
+    while (map.Find(id) != cpe::model::IdMap::kNotFound) id = generator();
+    ids.push_back(id);
+    EXPECT_TRUE(map.Insert(id, i));
+  }
+  EXPECT_FALSE(map.IsDense());
+  EXPECT_FALSE(map.Insert(ids[17], 0));
+  std::vector<std::size_t> indices(n);
+  map.Find(ids.data(), n, indices.data());
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(map.Find(ids[i]), i);
+    EXPECT_EQ(indices[i], i);
+  }
+
+  cpe::model::IdMap small;
+  small.Insert(1, 0);
+  small.Insert(100000, 1);
+  EXPECT_FALSE(small.IsDense());
+  for (std::size_t i = 2; i < 100000; ++i) small.Insert(i, i);
+  EXPECT_TRUE(small.IsDense());
+  EXPECT_EQ(small.Find(1), 0);
+  EXPECT_EQ(small.Find(100000), 1);
+  EXPECT_EQ(small.Find(99999), 99999);
+}
+
+}  // namespace
@@ -24,7 +24,7 @@
 
 namespace cpe::model {
 
-Material::Material(const std::string& n, double e, double nu)
-    : name_(n), e_(e), nu_(nu) {};
+Material::Material(const std::string& n, double e, double nu, double rho)
+    : name_(n), e_(e), nu_(nu), rho_(rho) {};
 
 }  // namespace cpe::model
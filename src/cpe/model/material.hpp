@@ -33,8 +33,9 @@ class Material {
   Material& operator=(const Material&) = delete;
   Material& operator=(Material&&) = delete;
 
-  Material(const std::string& name, double e, double nu);
+  Material(const std::string& name, double e, double nu, double rho = 0.0);
 
+  const double& Density() const { return rho_; }
   const double& YoungsModulus() const { return e_; }
   const double& PoissonsRatio() const { return nu_; }
 
@@ -43,6 +44,7 @@ class Material {
  private:
   double e_;
   double nu_;
+  double rho_;
 };
 
 }  // namespace cpe::model
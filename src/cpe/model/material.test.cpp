@@ -34,6 +34,13 @@ TEST(MaterialTest, Create) {
   EXPECT_EQ(material.name_, name);
   EXPECT_EQ(material.YoungsModulus(), E);
   EXPECT_EQ(material.PoissonsRatio(), nu);
+  EXPECT_EQ(material.Density(), 0.0);
+}
+
+TEST(MaterialTest, Density) {
+  const double rho = 7850.0;
+  cpe::model::Material material("Steel", 210.0e9, 0.3, rho);
+  EXPECT_EQ(material.Density(), rho);
 }
 
 }  // namespace
@@ -0,0 +1,144 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <algorithm>
+#include <cpe/model/mechanism.hpp>
+#include <cpe/model/model.hpp>
+#include <cpe/model/ordering.hpp>
+#include <stdexcept>
+#include <utility>
+
+namespace cpe::model {
+
+std::vector<Mechanism> FindMechanisms(Model& model, double tolerance) {
+  if (!model.stiffness_matrix_) {
+    throw std::runtime_error("Cannot find mechanisms before assembly.");
+  }
+  const cpe::matrix::Matrix& stiff = *model.stiffness_matrix_;
+  NodeList& nodes = model.nodes_;
+  const std::size_t num_nodes = nodes.GetNumNodes();
+  std::vector<std::size_t> ids(num_nodes);
+  for (const auto& [id, index] : nodes) ids[index] = id;
+
+  const std::vector<std::vector<std::size_t> > adjacent =
+      GetNodeAdjacency(model);
+
+  std::vector<Mechanism> result;
+  std::vector<bool> visited(num_nodes, false);
+  std::vector<std::size_t> position(num_nodes);
+  for (std::size_t start = 0; start < num_nodes; ++start) {
+    if (visited[start]) continue;
+
+    // Breadth-first numbering of the component
+    std::vector<std::size_t> component{start};
+    visited[start] = true;
+    for (std::size_t k = 0; k < component.size(); ++k) {
+      for (std::size_t next : adjacent[component[k]]) {
+        if (visited[next]) continue;
+        visited[next] = true;
+        component.push_back(next);
+      }
+    }
+    for (std::size_t k = 0; k < component.size(); ++k) {
+      position[component[k]] = k;
+    }
+
+    // Unconstrained degrees of freedom in that order, as rows of the system,
+    // and the first local row of any neighbouring node, which bounds the
+    // envelope of each row
+    std::vector<std::size_t> dofs;
+    std::vector<std::size_t> owner;
+    std::vector<std::size_t> node_first(component.size());
+    for (std::size_t k = 0; k < component.size(); ++k) {
+      node_first[k] = dofs.size();
+      const auto node = nodes[component[k]];
+      for (std::size_t d = 0; d < dof::kNumStrucDof; ++d) {
+        const std::size_t g = node.global_dof_index_[d];
+        if (g == dof::kInactiveDof || model.global_dof_constrained_[g]) {
+          continue;
+        }
+        dofs.push_back(model.system_index_[g]);
+        owner.push_back(k);
+      }
+    }
+    const std::size_t n = dofs.size();
+    if (n == 0) continue;
+    std::vector<std::size_t> first(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      std::size_t lowest = owner[i];
+      for (std::size_t neighbour : adjacent[component[owner[i]]]) {
+        lowest = std::min(lowest, position[neighbour]);
+      }
+      first[i] = std::min(node_first[lowest], i);
+    }
+    std::vector<std::size_t> offsets(n + 1, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+      offsets[i + 1] = offsets[i] + i + 1 - first[i];
+    }
+    std::vector<double> values(offsets[n]);
+    auto L = [&](std::size_t i, std::size_t j) -> double& {
+      return values[offsets[i] + j - first[i]];
+    };
+
+    // Envelope LDL^T, with L(i, i) holding D(i) and zero pivots pinned
+    std::vector<bool> zero_pivot(n, false);
+    std::size_t num_modes = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = first[i]; j < i; ++j) {
+        double value = stiff[dofs[i], dofs[j]];
+        for (std::size_t k = std::max(first[i], first[j]); k < j; ++k) {
+          value -= L(i, k) * L(k, k) * L(j, k);
+        }
+        L(i, j) = zero_pivot[j] ? 0.0 : value / L(j, j);
+      }
+      const double diagonal = stiff[dofs[i], dofs[i]];
+      double pivot = diagonal;
+      for (std::size_t k = first[i]; k < i; ++k) {
+        pivot -= L(i, k) * L(k, k) * L(i, k);
+      }
+      if (pivot <= tolerance * diagonal) {
+        zero_pivot[i] = true;
+        num_modes++;
+        pivot = 0.0;
+      }
+      L(i, i) = pivot;
+    }
+    if (num_modes == 0) continue;
+
+    Mechanism mechanism;
+    mechanism.num_modes_ = num_modes;
+    for (std::size_t node : component) {
+      mechanism.component_.push_back(ids[node]);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      if (zero_pivot[i]) mechanism.nodes_.push_back(ids[component[owner[i]]]);
+    }
+    std::sort(mechanism.component_.begin(), mechanism.component_.end());
+    std::sort(mechanism.nodes_.begin(), mechanism.nodes_.end());
+    mechanism.nodes_.erase(
+        std::unique(mechanism.nodes_.begin(), mechanism.nodes_.end()),
+        mechanism.nodes_.end());
+    result.push_back(std::move(mechanism));
+  }
+  return result;
+}
+
+}  // namespace cpe::model
@@ -0,0 +1,51 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace cpe::model {
+
+class Model;
+
+// Nodes joined through elements whose unconstrained degrees of freedom can
+// move without straining any element, e.g. an under-constrained truss
+struct Mechanism {
+  // Ids of every node in the connected component
+  std::vector<std::size_t> component_;
+  // Ids of the nodes owning the degrees of freedom that carry no stiffness
+  std::vector<std::size_t> nodes_;
+  // Number of independent zero-energy modes, rigid-body modes included
+  std::size_t num_modes_;
+};
+
+// Finds the mechanisms of an assembled model without solving it.  The nodes
+// are split into connected components through the element connectivity and
+// each component's unconstrained stiffness is factored, in breadth-first
+// order so that it stays within a narrow envelope, by an LDL^T that marks
+// every pivot below tolerance times its original diagonal as a zero-energy
+// mode and pins it.  The cost grows with the number of degrees of freedom
+// times the square of the envelope bandwidth.
+std::vector<Mechanism> FindMechanisms(Model& model, double tolerance = 1.0e-8);
+
+}  // namespace cpe::model
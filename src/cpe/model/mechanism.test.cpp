@@ -0,0 +1,136 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <cpe/model/element.hpp>
+#include <cpe/model/elementblock.hpp>
+#include <cpe/model/mechanism.hpp>
+#include <cpe/model/model.hpp>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+
+// Adds a block of truss elements joining the given node id pairs
+void AddTruss(cpe::model::Model& model,
+              const std::vector<std::pair<std::size_t, std::size_t> >& bars) {
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Aluminum", 70.0e9, 0.3);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 1.0e-4;
+  std::shared_ptr<ElementBlock> block =
+      std::make_shared<ElementBlock>("truss", property, bars.size());
+  model.blocks_.push_back(block);
+  for (const auto& [n1, n2] : bars) block->AddElement(n1, n2);
+}
+
+// A square with corners 1, 2 (bottom) and 3, 4 (top) in the xy-plane
+void AddSquare(cpe::model::Model& model) {
+  model.nodes_.AddNode(1, 0.0, 0.0);
+  model.nodes_.AddNode(2, 1.0, 0.0);
+  model.nodes_.AddNode(3, 0.0, 1.0);
+  model.nodes_.AddNode(4, 1.0, 1.0);
+}
+
+TEST(MechanismTest, Stable) {
+  cpe::model::Model model;
+  AddSquare(model);
+  model.AddConstraint(cpe::model::dof::kAllNon2d, 0.0);
+  AddTruss(model, {{1, 2}, {1, 3}, {2, 4}, {3, 4}, {1, 4}});
+  model.AddConstraint(cpe::model::dof::kAll, 0.0, 1);
+  model.AddConstraint(cpe::model::dof::kY, 0.0, 2);
+  model.Assemble();
+  EXPECT_TRUE(cpe::model::FindMechanisms(model).empty());
+}
+
+TEST(MechanismTest, RigidBody) {
+  cpe::model::Model model;
+  AddSquare(model);
+  model.AddConstraint(cpe::model::dof::kAllNon2d, 0.0);
+  AddTruss(model, {{1, 2}, {1, 3}, {2, 4}, {3, 4}, {1, 4}});
+  model.Assemble();
+  const auto mechanisms = cpe::model::FindMechanisms(model);
+  ASSERT_EQ(mechanisms.size(), 1);
+  // Two translations and a rotation in the plane
+  EXPECT_EQ(mechanisms[0].num_modes_, 3);
+  EXPECT_EQ(mechanisms[0].component_,
+            std::vector<std::size_t>({1, 2, 3, 4}));
+  EXPECT_FALSE(mechanisms[0].nodes_.empty());
+}
+
+TEST(MechanismTest, Sway) {
+  // Without a diagonal the pinned square sways sideways
+  cpe::model::Model model;
+  AddSquare(model);
+  model.AddConstraint(cpe::model::dof::kAllNon2d, 0.0);
+  AddTruss(model, {{1, 2}, {1, 3}, {2, 4}, {3, 4}});
+  model.AddConstraint(cpe::model::dof::kAll, 0.0, {1, 2});
+  model.Assemble();
+  const auto mechanisms = cpe::model::FindMechanisms(model);
+  ASSERT_EQ(mechanisms.size(), 1);
+  EXPECT_EQ(mechanisms[0].num_modes_, 1);
+  EXPECT_EQ(mechanisms[0].component_,
+            std::vector<std::size_t>({1, 2, 3, 4}));
+  ASSERT_EQ(mechanisms[0].nodes_.size(), 1);
+  EXPECT_GE(mechanisms[0].nodes_[0], 3);
+}
+
+TEST(MechanismTest, Components) {
+  // A stable triangle, a floating bar and a node without elements
+  cpe::model::Model model;
+  AddSquare(model);
+  model.nodes_.AddNode(5, 2.0, 0.0);
+  model.nodes_.AddNode(6, 3.0, 0.0);
+  model.nodes_.AddNode(7, 4.0, 0.0);
+  model.AddConstraint(cpe::model::dof::kAllNon2d, 0.0);
+  AddTruss(model, {{1, 2}, {1, 3}, {2, 3}, {5, 6}});
+  model.AddConstraint(cpe::model::dof::kAll, 0.0, {1, 4});
+  model.AddConstraint(cpe::model::dof::kY, 0.0, 2);
+  model.AddConstraint(cpe::model::dof::kY, 0.0, 7);
+  model.Assemble();
+  const auto mechanisms = cpe::model::FindMechanisms(model);
+  ASSERT_EQ(mechanisms.size(), 2);
+  EXPECT_EQ(mechanisms[0].component_, std::vector<std::size_t>({5, 6}));
+  EXPECT_EQ(mechanisms[0].num_modes_, 3);
+  EXPECT_EQ(mechanisms[1].component_, std::vector<std::size_t>({7}));
+  EXPECT_EQ(mechanisms[1].nodes_, std::vector<std::size_t>({7}));
+  EXPECT_EQ(mechanisms[1].num_modes_, 1);
+}
+
+TEST(MechanismTest, Solve) {
+  cpe::model::Model model;
+  AddSquare(model);
+  model.AddConstraint(cpe::model::dof::kAllNon2d, 0.0);
+  AddTruss(model, {{1, 2}, {1, 3}, {2, 4}, {3, 4}});
+  model.AddConstraint(cpe::model::dof::kAll, 0.0, {1, 2});
+  model.AddForce(cpe::model::dof::kX, 1.0, 4);
+  EXPECT_THROW(cpe::model::FindMechanisms(model), std::runtime_error);
+  model.Assemble();
+  EXPECT_THROW(model.Solve(), std::runtime_error);
+}
+
+}  // namespace
@@ -19,12 +19,51 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
-#include <cpe/linearsolver/ssor.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cpe/linearsolver/automatic.hpp>
+#include <cpe/linearsolver/lanczos.hpp>
+#include <cpe/linearsolver/sweep.hpp>
+#include <cpe/model/mechanism.hpp>
 #include <cpe/model/model.hpp>
+#include <cpe/model/ordering.hpp>
+#include <iostream>
+#include <numbers>
 #include <ranges>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace cpe::model {
 
+namespace {
+
+// Rows dofs of global, one column per column of global
+cpe::matrix::Matrix Gather(const cpe::matrix::Matrix& global,
+                           const std::vector<std::size_t>& dofs) {
+  cpe::matrix::Matrix result(dofs.size(), global.GetNumColumns());
+  for (std::size_t i = 0; i < dofs.size(); ++i) {
+    for (std::size_t j = 0; j < global.GetNumColumns(); ++j) {
+      result[i, j] = global[dofs[i], j];
+    }
+  }
+  return result;
+}
+
+void Scatter(const cpe::matrix::Matrix& system,
+             const std::vector<std::size_t>& dofs,
+             cpe::matrix::Matrix& global) {
+  for (std::size_t i = 0; i < dofs.size(); ++i) {
+    for (std::size_t j = 0; j < system.GetNumColumns(); ++j) {
+      global[dofs[i], j] = system[i, j];
+    }
+  }
+}
+
+}  // namespace
+
 Model::Model() : global_dof_indices_assigned_(false) {};
 
 void Model::AddConstraint(dof::Dof dof, double v) {
@@ -35,14 +74,17 @@ void Model::AddConstraint(dof::Dof dof, double v, std::size_t node_id) {
   const std::array<dof::Dof, dof::kNumStrucDof> kDofs{
       dof::kX, dof::kY, dof::kZ, dof::kDx, dof::kDy, dof::kDz};
   AssignGlobalDofIndices();
+  constraints_changed_ = true;
+  solver_.Reset();
   if (constraints_.count(node_id) == 0) constraints_[node_id] = dof::kNone;
   constraints_[node_id] = static_cast<dof::Dof>(constraints_[node_id] | dof);
-  Node& node = nodes_.GetNodeById(node_id);
+  const auto node = nodes_.GetNodeById(node_id);
   auto& global_dof = (*global_dof_);
   for (std::size_t i = 0; i < kDofs.size(); ++i) {
-    if (dof & kDofs[i]) {
-      global_dof[node.global_dof_index_[i]] = v;
-      global_dof_constrained_[node.global_dof_index_[i]] = true;
+    const std::size_t index = node.global_dof_index_[i];
+    if ((dof & kDofs[i]) && index != dof::kInactiveDof) {
+      global_dof[index] = v;
+      global_dof_constrained_[index] = true;
     }
   }
 }
@@ -57,14 +99,8 @@ void Model::AddForce(dof::Dof dof, double v) {
 }
 
 void Model::AddForce(dof::Dof dof, double v, std::size_t node_id) {
-  const std::array<dof::Dof, dof::kNumStrucDof> kDofs{
-      dof::kX, dof::kY, dof::kZ, dof::kDx, dof::kDy, dof::kDz};
   AssignGlobalDofIndices();
-  Node& node = nodes_.GetNodeById(node_id);
-  auto& applied_force = (*applied_force_);
-  for (std::size_t i = 0; i < kDofs.size(); ++i) {
-    if (dof & kDofs[i]) applied_force[node.global_dof_index_[i]] = v;
-  }
+  SetForce(*applied_force_, dof, v, node_id);
 }
 
 void Model::AddForce(dof::Dof dof, double v,
@@ -72,27 +108,54 @@ void Model::AddForce(dof::Dof dof, double v,
   for (std::size_t i : is) AddForce(dof, v, i);
 }
 
-void Model::Assemble() {
-  const std::array<dof::Dof, dof::kNumStrucDof> kDofs{
-      dof::kX, dof::kY, dof::kZ, dof::kDx, dof::kDy, dof::kDz};
-
-  // Add constraints for any dof not supported by any elements in the model
-  dof::Dof supported_dof = dof::kNone;
-  for (std::size_t i = 0; i < blocks_.size(); ++i) {
-    supported_dof =
-        static_cast<dof::Dof>(supported_dof | blocks_[i]->GetSupportedDof());
+void Model::AddForce(const std::string& load_case, dof::Dof dof, double v,
+                     std::size_t node_id) {
+  AssignGlobalDofIndices();
+  std::shared_ptr<cpe::matrix::Matrix>& force =
+      load_cases_[load_case].applied_force_;
+  if (!force) {
+    force = std::make_shared<cpe::matrix::Matrix>(global_dof_->GetNumRows(), 1);
   }
-  for (std::size_t i = 0; i < dof::kNumStrucDof; ++i) {
-    if ((supported_dof & kDofs[i]) == 0) {
-      AddConstraint(kDofs[i], 0.0);
+  SetForce(*force, dof, v, node_id);
+}
+
+void Model::AddForce(const std::string& load_case, dof::Dof dof, double v,
+                     const std::vector<std::size_t>& is) {
+  for (std::size_t i : is) AddForce(load_case, dof, v, i);
+}
+
+void Model::Assemble() {
+  AssignGlobalDofIndices();
+  solver_.Reset();
+  if (Reassemble()) return;
+  NumberSystemDof();
+  const std::size_t num_system_dof = system_dof_.size();
+  stiffness_matrix_ = std::make_shared<cpe::matrix::Matrix>(num_system_dof,
+                                                            num_system_dof);
+  induced_force_ =
+      std::make_shared<cpe::matrix::Matrix>(global_dof_->GetNumRows(), 1);
+  assembled_stiffness_ = stiffness_matrix_;
+  assembled_system_ = system_;
+  constraints_changed_ = false;
+  assembly_report_.incremental_ = false;
+  assembly_report_.num_elements_ = GetNumElements();
+  nodes_.ClearMovedNodes();
+  if (system_ == System::kReduced) {
+    // Prescribed values enter the right hand side as the blocks assemble, so
+    // there is nothing left to modify afterwards
+    for (std::size_t i = 0; i < blocks_.size(); ++i) {
+      blocks_[i]->Assemble(nodes_, system_index_, *global_dof_,
+                           *stiffness_matrix_, *induced_force_, pool_);
+    }
+    for (std::size_t i = 0; i < global_dof_->GetNumRows(); ++i) {
+      if (global_dof_constrained_[i]) (*induced_force_)[i] = (*global_dof_)[i];
     }
+    return;
   }
 
   // Assemble the stiffness matrix
-  stiffness_matrix_ = std::make_shared<cpe::matrix::Matrix>(
-      global_dof_->GetNumRows(), global_dof_->GetNumRows());
   for (std::size_t i = 0; i < blocks_.size(); ++i)
-    blocks_[i]->Assemble(nodes_, stiffness_matrix_);
+    blocks_[i]->Assemble(nodes_, *stiffness_matrix_, pool_);
 
   // Modify system to enforce constraints
   auto& stiff = *stiffness_matrix_;
@@ -105,7 +168,7 @@ void Model::Assemble() {
           force[i] = dof[i];
           stiff[i, i] = 1.0;
         } else {
-          force[i] -= stiff[j, i] * dof[i];
+          if (!global_dof_constrained_[j]) force[j] -= stiff[j, i] * dof[i];
           stiff[j, i] = 0.0;
           stiff[i, j] = 0.0;
         }
@@ -114,6 +177,60 @@ void Model::Assemble() {
   }
 }
 
+bool Model::Reassemble() {
+  if (!stiffness_matrix_ || stiffness_matrix_ != assembled_stiffness_ ||
+      system_ != assembled_system_ || constraints_changed_) {
+    return false;
+  }
+  const bool reduced = system_ == System::kReduced;
+  for (std::size_t i = 0; i < blocks_.size(); ++i) {
+    if (!blocks_[i]->CanUpdate(*stiffness_matrix_, reduced)) return false;
+  }
+  // Both systems keep the couplings to constrained dof in induced_force_, so
+  // the change in stiffness carries over to it the same way
+  const std::vector<bool>* fixed = reduced ? nullptr : &global_dof_constrained_;
+  assembly_report_.incremental_ = true;
+  assembly_report_.num_elements_ = 0;
+  for (std::size_t i = 0; i < blocks_.size(); ++i) {
+    assembly_report_.num_elements_ += blocks_[i]->Update(
+        nodes_, fixed, *global_dof_, *stiffness_matrix_, *induced_force_);
+  }
+  nodes_.ClearMovedNodes();
+  return true;
+}
+
+void Model::AssembleMass(Mass mass) {
+  AssignGlobalDofIndices();
+  if (system_ == System::kReduced) {
+    if (!stiffness_matrix_ ||
+        system_index_.size() != global_dof_->GetNumRows()) {
+      throw std::runtime_error(
+          "Cannot assemble a reduced mass matrix before the stiffness "
+          "matrix.");
+    }
+    mass_matrix_ = std::make_shared<cpe::matrix::Matrix>(system_dof_.size(),
+                                                         system_dof_.size());
+    for (std::size_t i = 0; i < blocks_.size(); ++i)
+      blocks_[i]->AssembleMass(nodes_, mass, *mass_matrix_, &system_index_);
+    return;
+  }
+
+  mass_matrix_ = std::make_shared<cpe::matrix::Matrix>(
+      global_dof_->GetNumRows(), global_dof_->GetNumRows());
+  for (std::size_t i = 0; i < blocks_.size(); ++i)
+    blocks_[i]->AssembleMass(nodes_, mass, *mass_matrix_);
+
+  auto& mass_matrix = *mass_matrix_;
+  for (std::size_t i = 0; i < mass_matrix.GetNumRows(); ++i) {
+    if (global_dof_constrained_[i]) {
+      for (std::size_t j = 0; j < mass_matrix.GetNumRows(); ++j) {
+        mass_matrix[i, j] = 0.0;
+        mass_matrix[j, i] = 0.0;
+      }
+    }
+  }
+}
+
 std::size_t Model::GetNumElements() const {
   std::size_t result = 0;
   for (std::size_t i = 0; i < blocks_.size(); ++i) {
@@ -122,29 +239,298 @@ std::size_t Model::GetNumElements() const {
   return result;
 }
 
-int Model::Solve() {
+int Model::Solve(cpe::linearsolver::automatic::Method method) {
+  if (!SetupSolver(method)) return -1;
+  const int result = SolveFor(*applied_force_, *global_dof_);
+  solve_report_ = solver_.report_;
+  return result;
+}
+
+int Model::SolveLoadCases(cpe::linearsolver::automatic::Method method) {
+  if (!SetupSolver(method)) return -1;
+  int total = 0;
+  for (auto& [name, load_case] : load_cases_) {
+    std::shared_ptr<cpe::matrix::Matrix>& x = load_case.global_dof_;
+    if (!x || x->GetNumRows() != global_dof_->GetNumRows()) {
+      x = std::make_shared<cpe::matrix::Matrix>(*global_dof_);
+    }
+    // The last solution is the starting guess, with the current prescribed
+    // values
+    for (std::size_t i = 0; i < global_dof_->GetNumRows(); ++i) {
+      if (global_dof_constrained_[i]) (*x)[i] = (*global_dof_)[i];
+    }
+    load_case.iterations_ = SolveFor(*load_case.applied_force_, *x);
+    solve_report_ = solver_.report_;
+    if (load_case.iterations_ < 0) {
+      std::cout << "Load case " << name << " did not solve." << std::endl;
+      return -1;
+    }
+    total += load_case.iterations_;
+  }
+  return total;
+}
+
+int Model::SolveModes(std::size_t num_modes, double shift) {
+  if (!stiffness_matrix_ || !mass_matrix_) {
+    throw std::runtime_error("Cannot solve for modes before assembly.");
+  }
+  if (shift == 0.0) CheckMechanisms();
+  cpe::matrix::Matrix values(num_modes, 1);
+  mode_shapes_ = std::make_shared<cpe::matrix::Matrix>(1, 1);
+  int result = cpe::linearsolver::lanczos::Solve(
+      *stiffness_matrix_, *mass_matrix_, num_modes, values, *mode_shapes_,
+      shift);
+  if (result < 0) {
+    mode_shapes_.reset();
+    frequencies_.reset();
+    return result;
+  }
+  if (system_ == System::kReduced) {
+    // Eliminated dof do not move
+    auto reduced = mode_shapes_;
+    mode_shapes_ = std::make_shared<cpe::matrix::Matrix>(
+        global_dof_->GetNumRows(), reduced->GetNumColumns());
+    Scatter(*reduced, system_dof_, *mode_shapes_);
+  }
+  frequencies_ = std::make_shared<cpe::matrix::Matrix>(num_modes, 1);
+  for (std::size_t i = 0; i < num_modes; ++i) {
+    (*frequencies_)[i] =
+        std::sqrt(std::max(values[i], 0.0)) / (2.0 * std::numbers::pi);
+  }
+  return result;
+}
+
+int Model::SolveFrequencyResponse(const std::vector<double>& frequencies) {
+  if (!stiffness_matrix_ || !mass_matrix_) {
+    throw std::runtime_error("Cannot solve for a response before assembly.");
+  }
+  std::vector<double> omegas;
+  for (double f : frequencies) omegas.push_back(2.0 * std::numbers::pi * f);
   cpe::matrix::Matrix all_forces = *applied_force_ + *induced_force_;
-  int result = cpe::linearsolver::ssor::Solve(*stiffness_matrix_, *global_dof_,
-                                              all_forces, 1.0e-10, 1.5);
+  frequency_response_ = std::make_shared<cpe::matrix::Matrix>(1, 1);
+  if (system_ == System::kFull) {
+    int result = cpe::linearsolver::sweep::Solve(
+        *stiffness_matrix_, *mass_matrix_, all_forces, omegas,
+        *frequency_response_, sweep_report_);
+    if (result < 0) frequency_response_.reset();
+    return result;
+  }
+
+  // Eliminated dof keep their prescribed amplitude at every frequency
+  cpe::matrix::Matrix response(1, 1);
+  int result = cpe::linearsolver::sweep::Solve(
+      *stiffness_matrix_, *mass_matrix_, Gather(all_forces, system_dof_),
+      omegas, response, sweep_report_);
+  if (result < 0) {
+    frequency_response_.reset();
+    return result;
+  }
+  frequency_response_ = std::make_shared<cpe::matrix::Matrix>(
+      global_dof_->GetNumRows(), omegas.size());
+  for (std::size_t i = 0; i < global_dof_->GetNumRows(); ++i) {
+    for (std::size_t f = 0; f < omegas.size(); ++f) {
+      (*frequency_response_)[i, f] = (*global_dof_)[i];
+    }
+  }
+  Scatter(response, system_dof_, *frequency_response_);
   return result;
 }
 
 void Model::AssignGlobalDofIndices() {
-  if (global_dof_indices_assigned_) return;
+  const std::size_t num_nodes = nodes_.GetNumNodes();
+  const std::size_t num_elements = GetNumElements();
+  if (global_dof_indices_assigned_ && numbered_nodes_ == num_nodes &&
+      numbered_elements_ == num_elements && numbered_ordering_ == ordering_) {
+    return;
+  }
+
+  const std::array<dof::Dof, dof::kNumStrucDof> kDofs{
+      dof::kX, dof::kY, dof::kZ, dof::kDx, dof::kDy, dof::kDz};
+
+  // Only the dof supported by some element on a node are numbered, the rest
+  // are dof::kInactiveDof.  A node without elements keeps every dof the model
+  // supports, so that it still takes loads and shows up as a mechanism.
+  dof::Dof model_dof = blocks_.empty() ? dof::kAll : dof::kNone;
+  std::vector<dof::Dof> node_dof(num_nodes, dof::kNone);
+  std::vector<std::size_t> index;
+  for (std::size_t i = 0; i < blocks_.size(); ++i) {
+    ElementBlockBase& block = *blocks_[i];
+    const dof::Dof supported_dof = block.GetSupportedDof();
+    model_dof = static_cast<dof::Dof>(model_dof | supported_dof);
+    for (std::size_t e = 0; e < block.GetNumElements(); ++e) {
+      const std::span<const std::size_t> ids = block.GetElementNodes(e);
+      index.resize(ids.size());
+      nodes_.GetNodeIndices(ids, index);
+      for (std::size_t node : index) {
+        node_dof[node] = static_cast<dof::Dof>(node_dof[node] | supported_dof);
+      }
+    }
+  }
+  std::vector<std::size_t> num_node_dof(num_nodes, 0);
+  for (std::size_t i = 0; i < num_nodes; ++i) {
+    if (node_dof[i] == dof::kNone) node_dof[i] = model_dof;
+    for (std::size_t j = 0; j < dof::kNumStrucDof; ++j) {
+      if (node_dof[i] & kDofs[j]) num_node_dof[i]++;
+    }
+  }
 
+  // Nodes are numbered in the requested order, dof by dof within a node
+  const std::vector<std::vector<std::size_t> > adjacency =
+      GetNodeAdjacency(*this);
+  const std::vector<std::size_t> order = Order(ordering_, adjacency);
+  ordering_report_.ordering_ = ordering_;
+  ordering_report_.natural_ = ComputeProfile(
+      adjacency, num_node_dof, Order(Ordering::kNatural, adjacency));
+  ordering_report_.ordered_ = ComputeProfile(adjacency, num_node_dof, order);
+  if (ordering_ != Ordering::kNatural) {
+    std::cout << "Ordering: " << GetName(ordering_) << ", bandwidth "
+              << ordering_report_.natural_.bandwidth_ << " -> "
+              << ordering_report_.ordered_.bandwidth_ << ", profile "
+              << ordering_report_.natural_.profile_ << " -> "
+              << ordering_report_.ordered_.profile_ << std::endl;
+  }
+  std::vector<std::array<std::size_t, dof::kNumStrucDof> > previous_index;
+  for (std::size_t i = 0; i < num_nodes; ++i) {
+    previous_index.push_back(nodes_[i].global_dof_index_);
+  }
   std::size_t global_dof_count = 0;
-  for (std::size_t i = 0; i < nodes_.GetNumNodes(); ++i) {
+  for (std::size_t i : order) {
+    std::array<std::size_t, dof::kNumStrucDof>& index =
+        nodes_[i].global_dof_index_;
     for (std::size_t j = 0; j < dof::kNumStrucDof; ++j) {
-      nodes_[i].global_dof_index_[j] = global_dof_count++;
+      index[j] =
+          (node_dof[i] & kDofs[j]) ? global_dof_count++ : dof::kInactiveDof;
     }
   }
 
-  global_dof_ = std::make_shared<cpe::matrix::Matrix>(global_dof_count, 1);
-  applied_force_ = std::make_shared<cpe::matrix::Matrix>(global_dof_count, 1);
-  induced_force_ = std::make_shared<cpe::matrix::Matrix>(global_dof_count, 1);
-  global_dof_constrained_.resize(global_dof_count, false);
+  // Renumbering after more nodes or elements were added, or for another
+  // ordering, keeps the values already set on the dof that stay active
+  auto global_dof = std::make_shared<cpe::matrix::Matrix>(global_dof_count, 1);
+  auto applied_force =
+      std::make_shared<cpe::matrix::Matrix>(global_dof_count, 1);
+  auto induced_force =
+      std::make_shared<cpe::matrix::Matrix>(global_dof_count, 1);
+  std::vector<bool> global_dof_constrained(global_dof_count, false);
+  if (global_dof_indices_assigned_) {
+    for (std::size_t i = 0; i < numbered_nodes_; ++i) {
+      for (std::size_t j = 0; j < dof::kNumStrucDof; ++j) {
+        const std::size_t from = previous_index[i][j];
+        const std::size_t to = nodes_[i].global_dof_index_[j];
+        if (from == dof::kInactiveDof || to == dof::kInactiveDof) continue;
+        (*global_dof)[to] = (*global_dof_)[from];
+        (*applied_force)[to] = (*applied_force_)[from];
+        (*induced_force)[to] = (*induced_force_)[from];
+        global_dof_constrained[to] = global_dof_constrained_[from];
+      }
+    }
+    // The forces of each load case move the same way, their solutions start
+    // again from global_dof_
+    for (auto& [name, load_case] : load_cases_) {
+      auto force = std::make_shared<cpe::matrix::Matrix>(global_dof_count, 1);
+      for (std::size_t i = 0; i < numbered_nodes_; ++i) {
+        for (std::size_t j = 0; j < dof::kNumStrucDof; ++j) {
+          const std::size_t from = previous_index[i][j];
+          const std::size_t to = nodes_[i].global_dof_index_[j];
+          if (from == dof::kInactiveDof || to == dof::kInactiveDof) continue;
+          (*force)[to] = (*load_case.applied_force_)[from];
+        }
+      }
+      load_case.applied_force_ = force;
+      load_case.global_dof_.reset();
+    }
+    for (std::size_t i = 0; i < blocks_.size(); ++i) blocks_[i]->ResetScatter();
+    // The mass and what was solved with it are numbered the old way
+    mass_matrix_.reset();
+    mode_shapes_.reset();
+    frequencies_.reset();
+    frequency_response_.reset();
+  }
+  global_dof_ = global_dof;
+  applied_force_ = applied_force;
+  induced_force_ = induced_force;
+  global_dof_constrained_ = std::move(global_dof_constrained);
 
+  constraints_changed_ = true;
   global_dof_indices_assigned_ = true;
+  numbered_elements_ = num_elements;
+  numbered_nodes_ = num_nodes;
+  numbered_ordering_ = ordering_;
+}
+
+void Model::SetForce(cpe::matrix::Matrix& force, dof::Dof dof, double v,
+                     std::size_t node_id) {
+  const std::array<dof::Dof, dof::kNumStrucDof> kDofs{
+      dof::kX, dof::kY, dof::kZ, dof::kDx, dof::kDy, dof::kDz};
+  const auto node = nodes_.GetNodeById(node_id);
+  for (std::size_t i = 0; i < kDofs.size(); ++i) {
+    const std::size_t index = node.global_dof_index_[i];
+    if ((dof & kDofs[i]) && index != dof::kInactiveDof) force[index] = v;
+  }
+}
+
+bool Model::SetupSolver(cpe::linearsolver::automatic::Method method) {
+  if (constraints_changed_ && stiffness_matrix_ &&
+      stiffness_matrix_ == assembled_stiffness_) {
+    throw std::runtime_error(
+        "Cannot solve after changing constraints before assembling again.");
+  }
+  if (solver_.IsSetup() && solver_stiffness_ == stiffness_matrix_ &&
+      solver_method_ == method) {
+    return true;
+  }
+  CheckMechanisms();
+  solver_stiffness_ = stiffness_matrix_;
+  solver_method_ = method;
+  if (solver_.Setup(*stiffness_matrix_, 1.0e-10, method)) return true;
+  solve_report_ = solver_.report_;
+  solve_report_.iterations_ = -1;
+  solver_stiffness_.reset();
+  return false;
+}
+
+int Model::SolveFor(const cpe::matrix::Matrix& applied_force,
+                    cpe::matrix::Matrix& x) {
+  cpe::matrix::Matrix all_forces = applied_force + *induced_force_;
+  if (system_ == System::kReduced) {
+    cpe::matrix::Matrix x_system = Gather(x, system_dof_);
+    const int result =
+        solver_.Solve(x_system, Gather(all_forces, system_dof_));
+    Scatter(x_system, system_dof_, x);
+    return result;
+  }
+  return solver_.Solve(x, all_forces);
+}
+
+void Model::CheckMechanisms() {
+  const std::vector<Mechanism> mechanisms = FindMechanisms(*this);
+  if (mechanisms.empty()) return;
+  std::stringstream msg;
+  msg << "Cannot solve, the model has " << mechanisms.size()
+      << " mechanism(s):";
+  for (const Mechanism& mechanism : mechanisms) {
+    msg << " " << mechanism.num_modes_ << " mode(s) of the "
+        << mechanism.component_.size() << " connected node(s) at nodes";
+    for (std::size_t id : mechanism.nodes_) msg << " " << id;
+    msg << ";";
+  }
+  throw std::runtime_error(msg.str());
+}
+
+void Model::NumberSystemDof() {
+  const std::size_t num_dof = global_dof_->GetNumRows();
+  std::vector<std::size_t> system_index(num_dof, dof::kInactiveDof);
+  system_dof_.clear();
+  for (std::size_t i = 0; i < num_dof; ++i) {
+    if (system_ == System::kReduced && global_dof_constrained_[i]) continue;
+    system_index[i] = system_dof_.size();
+    system_dof_.push_back(i);
+  }
+
+  // The blocks' slot maps follow the numbering
+  if (system_index != system_index_) {
+    for (std::size_t i = 0; i < blocks_.size(); ++i) blocks_[i]->ResetScatter();
+    system_index_ = std::move(system_index);
+  }
 }
 
 }  // namespace cpe::model
@@ -21,19 +21,47 @@
 // SOFTWARE.
 #pragma once
 
+#include <cpe/linearsolver/automatic.hpp>
+#include <cpe/linearsolver/sweep.hpp>
 #include <cpe/matrix/matrix.hpp>
 #include <cpe/model/dof.hpp>
 #include <cpe/model/elementblock.hpp>
 #include <cpe/model/nodelist.hpp>
+#include <cpe/model/ordering.hpp>
+#include <cpe/parallel/threadpool.hpp>
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace cpe::model {
 
+// Whether constrained dof stay in the assembled system as identity rows, or
+// are eliminated from it with their couplings moved to the right hand side
+enum class System { kFull, kReduced };
+
+// Whether the last Assemble only updated the elements changed since the one
+// before, and how many elements it assembled
+struct AssemblyReport {
+  bool incremental_ = false;
+  std::size_t num_elements_ = 0;
+};
+
+// Applied forces of one load case and its solution, both by global dof
+struct LoadCase {
+  std::shared_ptr<cpe::matrix::Matrix> applied_force_;
+  std::shared_ptr<cpe::matrix::Matrix> global_dof_;
+  int iterations_ = 0;
+};
+
 class Model {
  public:
   Model();
 
+  // Only the dof supported by an element on the node are numbered, and
+  // constraints and forces on the others are ignored.  The dof are numbered
+  // again, keeping the values already set, whenever nodes or elements have
+  // been added since.
   void AddConstraint(dof::Dof dof, double v);
   void AddConstraint(dof::Dof dof, double v, std::size_t i);
   void AddConstraint(dof::Dof dof, double v,
@@ -42,26 +70,102 @@ class Model {
   void AddForce(dof::Dof dof, double v);
   void AddForce(dof::Dof dof, double v, std::size_t i);
   void AddForce(dof::Dof dof, double v, const std::vector<std::size_t>& is);
+  // Forces of the named load case, which starts from zero on first use
+  void AddForce(const std::string& load_case, dof::Dof dof, double v,
+                std::size_t i);
+  void AddForce(const std::string& load_case, dof::Dof dof, double v,
+                const std::vector<std::size_t>& is);
 
+  // Assembles stiffness_matrix_, over the dof of the system_ numbered in
+  // system_dof_, spreading the elements of each color over pool_ when one is
+  // set.  When only nodes moved through NodeList::MoveNode or properties
+  // changed since the last Assemble, only the elements they touch are
+  // updated in place.  New constraints, nodes or elements, another system_
+  // or a replaced stiffness_matrix_ assemble from zero.
   void Assemble();
+  // Assembles mass_matrix_ over the same dof as the stiffness matrix, with
+  // zero mass on the constrained dof of a full system so that they drop out
+  // of the modes.  A reduced system needs Assemble first.  Renumbering the dof
+  // discards it, with the modes and response solved from it.
+  void AssembleMass(Mass mass = Mass::kLumped);
 
   std::size_t GetNumElements() const;
   std::size_t GetNumNodes() const { return nodes_.GetNumNodes(); }
 
-  int Solve();
+  // Solves with the method chosen from the stiffness matrix, or with method
+  // when one is given; the decision is kept in solve_report_.  Throws if
+  // FindMechanisms finds any, before starting the solver.  The factorization
+  // or preconditioner is kept until the next Assemble, so later solves with
+  // other applied forces only pay for the substitution.  The couplings to
+  // prescribed values are fixed at Assemble, so solving an assembled model
+  // after AddConstraint throws until it is assembled again.
+  int Solve(cpe::linearsolver::automatic::Method method =
+                cpe::linearsolver::automatic::Method::kAutomatic);
+  // Solves every load case against the same kept solver, each with its own
+  // applied forces and the induced forces of the constraints.  Returns the
+  // total number of iterations, or -1 if a load case could not be solved.
+  int SolveLoadCases(cpe::linearsolver::automatic::Method method =
+                         cpe::linearsolver::automatic::Method::kAutomatic);
+  // Finds the num_modes natural frequencies, in cycles per unit time, and
+  // mode shapes nearest the squared circular frequency shift.  Needs both
+  // Assemble and AssembleMass, and a negative shift for an unsupported model.
+  // Returns the number of solves, or -1 if the modes did not converge.
+  int SolveModes(std::size_t num_modes, double shift = 0.0);
+  // Solves the harmonic response to the applied and induced forces at each
+  // frequency, in cycles per unit time, into the columns of
+  // frequency_response_, reusing factorizations across frequencies as kept in
+  // sweep_report_.  Needs both Assemble and AssembleMass.  Returns the total
+  // number of iterations, or -1 if a frequency could not be solved.
+  int SolveFrequencyResponse(const std::vector<double>& frequencies);
 
   std::vector<std::shared_ptr<ElementBlockBase> > blocks_;
   std::map<std::size_t, dof::Dof> constraints_;
+  std::map<std::string, LoadCase> load_cases_;
   std::shared_ptr<cpe::matrix::Matrix> global_dof_;
   std::vector<bool> global_dof_constrained_;
   std::shared_ptr<cpe::matrix::Matrix> applied_force_;
+  AssemblyReport assembly_report_;
   std::shared_ptr<cpe::matrix::Matrix> induced_force_;
+  std::shared_ptr<cpe::matrix::Matrix> frequencies_;
+  std::shared_ptr<cpe::matrix::Matrix> frequency_response_;
+  std::shared_ptr<cpe::matrix::Matrix> mass_matrix_;
+  std::shared_ptr<cpe::matrix::Matrix> mode_shapes_;
   NodeList nodes_;
+  // Order in which the nodes' dof are numbered, and the bandwidth and profile
+  // of the stiffness matrix with the natural and with that order
+  Ordering ordering_ = Ordering::kNatural;
+  OrderingReport ordering_report_;
+  cpe::parallel::ThreadPool* pool_ = nullptr;
+  cpe::linearsolver::automatic::Report solve_report_;
+  cpe::linearsolver::sweep::Report sweep_report_;
   std::shared_ptr<cpe::matrix::Matrix> stiffness_matrix_;
+  System system_ = System::kFull;
+  // Global dof of each row of the system, and the row of each global dof or
+  // dof::kInactiveDof if it was eliminated
+  std::vector<std::size_t> system_dof_;
+  std::vector<std::size_t> system_index_;
 
  private:
   void AssignGlobalDofIndices();
+  void CheckMechanisms();
+  void NumberSystemDof();
+  bool Reassemble();
+  void SetForce(cpe::matrix::Matrix& force, dof::Dof dof, double v,
+                std::size_t node_id);
+  bool SetupSolver(cpe::linearsolver::automatic::Method method);
+  int SolveFor(const cpe::matrix::Matrix& applied_force,
+               cpe::matrix::Matrix& x);
+  std::shared_ptr<const cpe::matrix::Matrix> assembled_stiffness_;
+  System assembled_system_ = System::kFull;
+  bool constraints_changed_ = true;
   bool global_dof_indices_assigned_;
+  std::size_t numbered_elements_ = 0;
+  std::size_t numbered_nodes_ = 0;
+  Ordering numbered_ordering_ = Ordering::kNatural;
+  cpe::linearsolver::automatic::Solver solver_;
+  cpe::linearsolver::automatic::Method solver_method_ =
+      cpe::linearsolver::automatic::Method::kAutomatic;
+  std::shared_ptr<const cpe::matrix::Matrix> solver_stiffness_;
 };
 
 }  // namespace cpe::model
@@ -21,9 +21,16 @@
 // SOFTWARE.
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cpe/linearsolver/lu.hpp>
 #include <cpe/linearsolver/ssor.hpp>
 #include <cpe/model/element.hpp>
 #include <cpe/model/model.hpp>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace {
 
@@ -170,12 +177,86 @@ TEST(ModelTest, Assemble) {
   block->AddElement(1, 2);
   model.AddConstraint(cpe::model::dof::kAll, 0.0, 1);
   model.AddConstraint(cpe::model::dof::kAllNon2d, 0.0);
-  // NOTE: Assembly will add a constraint on kDz since the element doesn't
-  // support that
+  // NOTE: The rotations are inactive since the element doesn't support them
   model.AddForce(cpe::model::dof::kX, 1.0, 1);
   model.Assemble();
-  EXPECT_EQ(model.stiffness_matrix_->GetNumColumns(), 12);
-  EXPECT_EQ(model.stiffness_matrix_->GetNumRows(), 12);
+  EXPECT_EQ(model.stiffness_matrix_->GetNumColumns(), 6);
+  EXPECT_EQ(model.stiffness_matrix_->GetNumRows(), 6);
+  EXPECT_EQ(model.nodes_[1].global_dof_index_[cpe::model::dof::kIz], 5);
+  EXPECT_EQ(model.nodes_[1].global_dof_index_[cpe::model::dof::kIdx],
+            cpe::model::dof::kInactiveDof);
+}
+
+TEST(ModelTest, InactiveDof) {
+  // Constraints set before the elements are added carry over to the dof the
+  // elements use, and loads on the rotations go nowhere
+  cpe::model::Model model;
+  model.nodes_.AddNode(1, 0.0);
+  model.nodes_.AddNode(2, 1.0);
+  model.AddConstraint(cpe::model::dof::kX, 0.5, 2);
+  EXPECT_EQ(model.global_dof_->GetNumRows(), 12);
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Aluminum", 70.0e9, 0.3);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 1.0;
+  using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+  std::shared_ptr<ElementBlock> block =
+      std::make_shared<ElementBlock>("truss", property, 1);
+  model.blocks_.push_back(block);
+  block->AddElement(1, 2);
+  model.AddForce(cpe::model::dof::kAllRot, 1.0, 2);
+  EXPECT_EQ(model.global_dof_->GetNumRows(), 6);
+  const std::size_t x2 = model.nodes_[1].global_dof_index_[0];
+  EXPECT_EQ(x2, 3);
+  EXPECT_EQ((*model.global_dof_)[x2], 0.5);
+  EXPECT_TRUE(model.global_dof_constrained_[x2]);
+  for (std::size_t i = 0; i < 6; ++i) {
+    EXPECT_EQ((*model.applied_force_)[i], 0.0);
+  }
+
+  // A node added later is numbered with the dof the model supports
+  model.nodes_.AddNode(3, 2.0);
+  model.Assemble();
+  EXPECT_EQ(model.stiffness_matrix_->GetNumRows(), 9);
+  EXPECT_EQ((*model.global_dof_)[x2], 0.5);
+}
+
+TEST(ModelTest, AssembleTwice) {
+  // A bar of two elements with its end prescribed, assembled twice; the
+  // middle node keeps the coupling to the end only once
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Aluminum", 70.0e9, 0.3);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 1.0;
+  const double k = 70.0e9;
+  using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+  for (cpe::model::System system :
+       {cpe::model::System::kFull, cpe::model::System::kReduced}) {
+    cpe::model::Model model;
+    model.system_ = system;
+    model.nodes_.AddNode(1, 0.0);
+    model.nodes_.AddNode(2, 1.0);
+    model.nodes_.AddNode(3, 2.0);
+    std::shared_ptr<ElementBlock> block =
+        std::make_shared<ElementBlock>("truss", property, 2);
+    model.blocks_.push_back(block);
+    block->AddElement(1, 2);
+    block->AddElement(2, 3);
+    model.AddConstraint(cpe::model::dof::kAllNon2d, 0.0);
+    model.AddConstraint(cpe::model::dof::kY, 0.0);
+    model.AddConstraint(cpe::model::dof::kX, 0.0, 1);
+    model.AddConstraint(cpe::model::dof::kX, 1.0, 3);
+    const std::size_t middle =
+        model.nodes_.GetNodeById(2).global_dof_index_[0];
+    for (int i = 0; i < 2; ++i) {
+      model.Assemble();
+      EXPECT_DOUBLE_EQ((*model.induced_force_)[middle], k);
+    }
+    ASSERT_GE(model.Solve(), 0);
+    EXPECT_NEAR((*model.global_dof_)[middle], 0.5, 1.0e-12);
+  }
 }
 
 TEST(ModelTest, GetNumberOfElements) {
@@ -227,7 +308,7 @@ TEST(ModelTest, Solve) {
   b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
   model.global_dof_ = std::make_shared<cpe::matrix::Matrix>(5, 1);
   cpe::matrix::Matrix& x = *(model.global_dof_);
-  int num_iter = model.Solve();
+  int num_iter = model.Solve(cpe::linearsolver::automatic::Method::kStationary);
   EXPECT_EQ(num_iter, 48);
   EXPECT_NEAR(x[0], 25.000000, 0.0001);
   EXPECT_NEAR(x[1], 35.714285, 0.0001);
@@ -236,4 +317,535 @@ TEST(ModelTest, Solve) {
   EXPECT_NEAR(x[4], 25.000000, 0.0001);
 }
 
+TEST(ModelTest, SolveAutomatic) {
+  cpe::model::Model model;
+  model.stiffness_matrix_ = std::make_shared<cpe::matrix::Matrix>(5, 5);
+  cpe::matrix::Matrix& A = *(model.stiffness_matrix_);
+  A[0, 0] = A[1, 1] = A[2, 2] = A[3, 3] = A[4, 4] = 4.0;
+  A[0, 1] = A[1, 2] = A[2, 3] = A[3, 4] = -1.0;
+  A[1, 0] = A[2, 1] = A[3, 2] = A[4, 3] = -1.0;
+  A[0, 3] = A[3, 0] = A[1, 4] = A[4, 1] = 1.0;
+  model.induced_force_ = std::make_shared<cpe::matrix::Matrix>(5, 1);
+  model.applied_force_ = std::make_shared<cpe::matrix::Matrix>(5, 1);
+  cpe::matrix::Matrix& b = *(model.applied_force_);
+  b[0] = b[1] = b[2] = b[3] = b[4] = 100.0;
+  model.global_dof_ = std::make_shared<cpe::matrix::Matrix>(5, 1);
+  cpe::matrix::Matrix& x = *(model.global_dof_);
+  int num_iter = model.Solve();
+  EXPECT_EQ(num_iter, 1);
+  EXPECT_EQ(model.solve_report_.method_,
+            cpe::linearsolver::automatic::Method::kDenseDirect);
+  EXPECT_EQ(model.solve_report_.analysis_.num_rows_, 5);
+  EXPECT_FALSE(model.solve_report_.rationale_.empty());
+  EXPECT_NEAR(x[0], 25.000000, 0.0001);
+  EXPECT_NEAR(x[1], 35.714285, 0.0001);
+  EXPECT_NEAR(x[2], 42.857143, 0.0001);
+  EXPECT_NEAR(x[3], 35.714285, 0.0001);
+  EXPECT_NEAR(x[4], 25.000000, 0.0001);
+}
+
+TEST(ModelTest, SolveAutomaticAssembled) {
+  // A braced lattice with perturbed nodes, fixed at its base; the assembled
+  // stiffness is symmetric, so the choice is not driven to dense lu
+  constexpr std::size_t n = 6;
+  auto id = [](std::size_t i, std::size_t j, std::size_t k) {
+    return (i * n + j) * n + k;
+  };
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Steel", 200.0e9, 0.3);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 1.0e-4;
+  using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+  std::shared_ptr<ElementBlock> block =
+      std::make_shared<ElementBlock>("lattice", property);
+  cpe::model::Model model;
+  model.blocks_.push_back(block);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t k = 0; k < n; ++k) {
+        const double t = static_cast<double>(id(i, j, k));
+        model.nodes_.AddNode(id(i, j, k), i + 0.1 * std::sin(t),
+                             j + 0.1 * std::cos(t), k + 0.1 * std::sin(2 * t));
+      }
+    }
+  }
+  // Every node to each neighbour whose first differing index is larger
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      for (std::size_t k = 0; k < n; ++k) {
+        for (int di = 0; di <= 1; ++di) {
+          for (int dj = di ? -1 : 0; dj <= 1; ++dj) {
+            for (int dk = (di || dj) ? -1 : 1; dk <= 1; ++dk) {
+              const std::size_t a = i + di, b = j + dj, c = k + dk;
+              if (a >= n || b >= n || c >= n) continue;
+              block->AddElement(id(i, j, k), id(a, b, c));
+            }
+          }
+        }
+      }
+    }
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      model.AddConstraint(cpe::model::dof::kAll, 0.0, id(i, j, 0));
+    }
+  }
+  model.AddForce(cpe::model::dof::kX, 1000.0, id(n - 1, n - 1, n - 1));
+  model.Assemble();
+
+  const cpe::matrix::Matrix& K = *model.stiffness_matrix_;
+  ASSERT_GT(K.GetNumRows(), 100);
+  const cpe::linearsolver::automatic::Analysis analysis =
+      cpe::linearsolver::automatic::Analyze(K);
+  EXPECT_TRUE(analysis.symmetric_);
+  ASSERT_GE(model.Solve(), 0);
+  EXPECT_NE(model.solve_report_.method_,
+            cpe::linearsolver::automatic::Method::kDenseDirect);
+  const std::size_t tip =
+      model.nodes_.GetNodeById(id(n - 1, n - 1, n - 1)).global_dof_index_[0];
+  EXPECT_GT((*model.global_dof_)[tip], 0.0);
+}
+
+TEST(ModelTest, SolveModes) {
+  // Axial vibration of a bar fixed at one end, whose exact fundamental
+  // frequency is bracketed by the lumped (below) and consistent (above) mass
+  const double E = 70.0e9;
+  const double rho = 2700.0;
+  const double L = 2.0;
+  constexpr std::size_t num_elements = 20;
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Aluminum", E, 0.3, rho);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 1.0e-4;
+  const double exact = std::sqrt(E / rho) / (4.0 * L);
+
+  for (cpe::model::Mass mass :
+       {cpe::model::Mass::kLumped, cpe::model::Mass::kConsistent}) {
+    cpe::model::Model model;
+    for (std::size_t i = 0; i <= num_elements; ++i) {
+      model.nodes_.AddNode(i, L * static_cast<double>(i) / num_elements);
+    }
+    using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+    std::shared_ptr<ElementBlock> block =
+        std::make_shared<ElementBlock>("bar", property, num_elements);
+    model.blocks_.push_back(block);
+    for (std::size_t i = 0; i < num_elements; ++i) block->AddElement(i, i + 1);
+    model.AddConstraint(
+        static_cast<cpe::model::dof::Dof>(cpe::model::dof::kY |
+                                          cpe::model::dof::kZ),
+        0.0);
+    model.AddConstraint(cpe::model::dof::kAll, 0.0, 0);
+    model.Assemble();
+    model.AssembleMass(mass);
+    EXPECT_GT(model.SolveModes(2), 0);
+    ASSERT_EQ(model.frequencies_->GetNumRows(), 2);
+    ASSERT_EQ(model.mode_shapes_->GetNumColumns(), 2);
+    const double f1 = (*model.frequencies_)[0];
+    const double f2 = (*model.frequencies_)[1];
+    if (mass == cpe::model::Mass::kLumped) {
+      EXPECT_LT(f1, exact);
+    } else {
+      EXPECT_GT(f1, exact);
+    }
+    EXPECT_NEAR(f1, exact, 0.01 * exact);
+    EXPECT_NEAR(f2, 3.0 * exact, 0.02 * exact);
+  }
+}
+
+TEST(ModelTest, SolveFrequencyResponse) {
+  // The bar of SolveModes driven axially at its free end, through its first
+  // resonance
+  const double E = 70.0e9;
+  const double A = 1.0e-4;
+  const double L = 2.0;
+  constexpr std::size_t num_elements = 20;
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Aluminum", E, 0.3, 2700.0);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = A;
+  cpe::model::Model model;
+  for (std::size_t i = 0; i <= num_elements; ++i) {
+    model.nodes_.AddNode(i, L * static_cast<double>(i) / num_elements);
+  }
+  using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+  std::shared_ptr<ElementBlock> block =
+      std::make_shared<ElementBlock>("bar", property, num_elements);
+  model.blocks_.push_back(block);
+  for (std::size_t i = 0; i < num_elements; ++i) block->AddElement(i, i + 1);
+  model.AddConstraint(
+      static_cast<cpe::model::dof::Dof>(cpe::model::dof::kY |
+                                        cpe::model::dof::kZ),
+      0.0);
+  model.AddConstraint(cpe::model::dof::kAll, 0.0, 0);
+  model.AddForce(cpe::model::dof::kX, 1.0, num_elements);
+  model.Assemble();
+  model.AssembleMass();
+  ASSERT_GT(model.SolveModes(1), 0);
+  const double f1 = (*model.frequencies_)[0];
+
+  constexpr std::size_t num_frequencies = 50;
+  std::vector<double> frequencies;
+  for (std::size_t i = 0; i < num_frequencies; ++i) {
+    frequencies.push_back((0.02 + 0.037 * static_cast<double>(i)) * f1);
+  }
+  EXPECT_GT(model.SolveFrequencyResponse(frequencies), 0);
+  EXPECT_LT(model.sweep_report_.shifts_.size(), num_frequencies / 4);
+  const cpe::matrix::Matrix& response = *model.frequency_response_;
+  ASSERT_EQ(response.GetNumColumns(), num_frequencies);
+
+  // Quasi-static below resonance and out of phase above it
+  const std::size_t tip =
+      model.nodes_.GetNodeById(num_elements).global_dof_index_[0];
+  const double low = response[tip, 0];
+  const double high = response[tip, num_frequencies - 1];
+  EXPECT_NEAR(low, L / (E * A), 0.01 * L / (E * A));
+  EXPECT_LT(high, 0.0);
+
+  // Against a direct solve at each frequency
+  const cpe::matrix::Matrix& K = *model.stiffness_matrix_;
+  const cpe::matrix::Matrix& M = *model.mass_matrix_;
+  const std::size_t n = K.GetNumRows();
+  const cpe::matrix::Matrix b = *model.applied_force_ + *model.induced_force_;
+  for (std::size_t f = 0; f < num_frequencies; f += 7) {
+    const double omega = 2.0 * std::numbers::pi * frequencies[f];
+    cpe::matrix::Matrix shifted(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        shifted[i, j] = K[i, j] - omega * omega * M[i, j];
+      }
+    }
+    cpe::matrix::Matrix x(n, 1);
+    ASSERT_EQ(cpe::linearsolver::lu::Solve(shifted, x, b), 1);
+    for (std::size_t i = 0; i < n; ++i) {
+      const double value = response[i, f];
+      EXPECT_NEAR(value, x[i], 1.0e-8 * std::abs(x[tip]));
+    }
+  }
+
+  // Extending the bar renumbers its dof, which the mass, modes and response
+  // no longer match
+  model.nodes_.AddNode(num_elements + 1, L + L / num_elements);
+  block->AddElement(num_elements, num_elements + 1);
+  model.AddForce(cpe::model::dof::kX, 1.0, num_elements + 1);
+  EXPECT_FALSE(model.mass_matrix_);
+  EXPECT_FALSE(model.mode_shapes_);
+  EXPECT_FALSE(model.frequencies_);
+  EXPECT_FALSE(model.frequency_response_);
+  EXPECT_THROW(model.SolveModes(1), std::runtime_error);
+}
+
+TEST(ModelTest, SolveReduced) {
+  // A braced cantilever with a prescribed settlement at one support, solved
+  // with and without the constrained dof in the system
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Steel", 200.0e9, 0.3, 7800.0);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 1.0e-4;
+  constexpr std::size_t num_bays = 4;
+  std::vector<cpe::model::Model> models(2);
+  models[1].system_ = cpe::model::System::kReduced;
+  for (cpe::model::Model& model : models) {
+    for (std::size_t i = 0; i <= num_bays; ++i) {
+      model.nodes_.AddNode(2 * i, 1.0 * i, 0.0);
+      model.nodes_.AddNode(2 * i + 1, 1.0 * i, 1.0);
+    }
+    using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+    std::shared_ptr<ElementBlock> block =
+        std::make_shared<ElementBlock>("truss", property, 4 * num_bays);
+    model.blocks_.push_back(block);
+    for (std::size_t i = 0; i < num_bays; ++i) {
+      block->AddElement(2 * i, 2 * i + 2);
+      block->AddElement(2 * i + 1, 2 * i + 3);
+      block->AddElement(2 * i + 1, 2 * i + 2);
+      block->AddElement(2 * i + 2, 2 * i + 3);
+    }
+    model.AddConstraint(cpe::model::dof::kZ, 0.0);
+    model.AddConstraint(cpe::model::dof::kAll, 0.0, 0);
+    model.AddConstraint(cpe::model::dof::kAll, 0.0, 1);
+    model.AddConstraint(cpe::model::dof::kY, -1.0e-3, 1);
+    model.AddForce(cpe::model::dof::kY, -1000.0, 2 * num_bays);
+    model.Assemble();
+    model.AssembleMass();
+    model.Solve(cpe::linearsolver::automatic::Method::kDenseDirect);
+  }
+  const cpe::model::Model& full = models[0];
+  const cpe::model::Model& reduced = models[1];
+  // x and y of all but the two supports
+  const std::size_t num_free = 4 * num_bays;
+  EXPECT_EQ(reduced.stiffness_matrix_->GetNumRows(), num_free);
+  EXPECT_EQ(reduced.mass_matrix_->GetNumRows(), num_free);
+  EXPECT_EQ(reduced.system_dof_.size(), num_free);
+  const std::size_t n = full.global_dof_->GetNumRows();
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_NEAR((*reduced.global_dof_)[i], (*full.global_dof_)[i], 1.0e-12);
+  }
+  const std::size_t tip_dof =
+      full.nodes_.GetNodeById(2 * num_bays).global_dof_index_[1];
+  const double tip = (*full.global_dof_)[tip_dof];
+  EXPECT_LT(tip, -1.0e-3);
+
+  for (cpe::model::Model& model : models) {
+    ASSERT_GT(model.SolveModes(3), 0);
+    ASSERT_GT(model.SolveFrequencyResponse({10.0, 100.0}), 0);
+  }
+  for (std::size_t m = 0; m < 3; ++m) {
+    const double f = (*full.frequencies_)[m];
+    EXPECT_NEAR((*reduced.frequencies_)[m], f, 1.0e-8 * f);
+  }
+  EXPECT_EQ(reduced.mode_shapes_->GetNumRows(), n);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t f = 0; f < 2; ++f) {
+      const double value = (*reduced.frequency_response_)[i, f];
+      const double expected = (*full.frequency_response_)[i, f];
+      EXPECT_NEAR(value, expected, 1.0e-12);
+    }
+  }
+}
+
+TEST(ModelTest, Reassemble) {
+  // A braced cantilever with a settlement, assembled once, then updated after
+  // moving nodes and changing the web area, against assembling from zero
+  constexpr std::size_t num_bays = 4;
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Steel", 200.0e9, 0.3, 7800.0);
+  using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+  auto build = [&](cpe::model::Model& model,
+                   std::shared_ptr<cpe::model::Property> chords,
+                   std::shared_ptr<cpe::model::Property> webs, bool moved) {
+    for (std::size_t i = 0; i <= num_bays; ++i) {
+      model.nodes_.AddNode(2 * i, 1.0 * i, 0.0);
+      model.nodes_.AddNode(2 * i + 1, 1.0 * i, 1.0);
+    }
+    if (moved) {
+      model.nodes_.MoveNode(2, 1.05, -0.02);
+      model.nodes_.MoveNode(2 * num_bays + 1, num_bays + 0.1, 1.2);
+    }
+    std::shared_ptr<ElementBlock> chord_block =
+        std::make_shared<ElementBlock>("chords", chords);
+    std::shared_ptr<ElementBlock> web_block =
+        std::make_shared<ElementBlock>("webs", webs);
+    model.blocks_.push_back(chord_block);
+    model.blocks_.push_back(web_block);
+    for (std::size_t i = 0; i < num_bays; ++i) {
+      chord_block->AddElement(2 * i, 2 * i + 2);
+      chord_block->AddElement(2 * i + 1, 2 * i + 3);
+      web_block->AddElement(2 * i + 1, 2 * i + 2);
+      web_block->AddElement(2 * i + 2, 2 * i + 3);
+    }
+    model.AddConstraint(cpe::model::dof::kZ, 0.0);
+    model.AddConstraint(cpe::model::dof::kAll, 0.0, 0);
+    model.AddConstraint(cpe::model::dof::kAll, 0.0, 1);
+    model.AddConstraint(cpe::model::dof::kY, -1.0e-3, 1);
+  };
+  for (cpe::model::System system :
+       {cpe::model::System::kFull, cpe::model::System::kReduced}) {
+    std::shared_ptr<cpe::model::Property> chords =
+        std::make_shared<cpe::model::Property>("chords", material);
+    std::shared_ptr<cpe::model::Property> webs =
+        std::make_shared<cpe::model::Property>("webs", material);
+    (*chords)["area"] = 1.0e-4;
+    (*webs)["area"] = 1.0e-4;
+    cpe::model::Model updated;
+    updated.system_ = system;
+    build(updated, chords, webs, false);
+    updated.Assemble();
+    EXPECT_FALSE(updated.assembly_report_.incremental_);
+    EXPECT_EQ(updated.assembly_report_.num_elements_, 4 * num_bays);
+    // Reading a property is not a change
+    EXPECT_EQ((*webs)["area"], 1.0e-4);
+    updated.Assemble();
+    EXPECT_TRUE(updated.assembly_report_.incremental_);
+    EXPECT_EQ(updated.assembly_report_.num_elements_, 0);
+
+    updated.nodes_.MoveNode(2, 1.05, -0.02);
+    updated.nodes_.MoveNode(2 * num_bays + 1, num_bays + 0.1, 1.2);
+    updated.Assemble();
+    EXPECT_TRUE(updated.assembly_report_.incremental_);
+    EXPECT_EQ(updated.assembly_report_.num_elements_, 6);
+    (*webs)["area"] = 2.0e-4;
+    updated.Assemble();
+    EXPECT_TRUE(updated.assembly_report_.incremental_);
+    EXPECT_EQ(updated.assembly_report_.num_elements_, 2 * num_bays);
+
+    cpe::model::Model expected;
+    expected.system_ = system;
+    build(expected, chords, webs, true);
+    expected.Assemble();
+    const cpe::matrix::Matrix& K = *updated.stiffness_matrix_;
+    const cpe::matrix::Matrix& K0 = *expected.stiffness_matrix_;
+    ASSERT_EQ(K.GetNumRows(), K0.GetNumRows());
+    const double scale = 200.0e9 * 2.0e-4;
+    for (std::size_t i = 0; i < K.GetNumRows() * K.GetNumColumns(); ++i) {
+      EXPECT_NEAR(K[i], K0[i], 1.0e-10 * scale);
+    }
+    const cpe::matrix::Matrix& f = *updated.induced_force_;
+    const cpe::matrix::Matrix& f0 = *expected.induced_force_;
+    for (std::size_t i = 0; i < f.GetNumRows(); ++i) {
+      EXPECT_NEAR(f[i], f0[i], 1.0e-10 * scale * 1.0e-3);
+    }
+
+    updated.AddConstraint(cpe::model::dof::kY, -2.0e-3, 1);
+    updated.Assemble();
+    EXPECT_FALSE(updated.assembly_report_.incremental_);
+  }
+}
+
+TEST(ModelTest, LoadCases) {
+  // A braced cantilever with a settlement and two load cases at the tip,
+  // solved against one factorization and each on its own
+  constexpr std::size_t num_bays = 4;
+  constexpr std::size_t tip = 2 * num_bays;
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Steel", 200.0e9, 0.3, 7800.0);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 1.0e-4;
+  using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+  auto build = [&](cpe::model::Model& model) {
+    for (std::size_t i = 0; i <= num_bays; ++i) {
+      model.nodes_.AddNode(2 * i, 1.0 * i, 0.0);
+      model.nodes_.AddNode(2 * i + 1, 1.0 * i, 1.0);
+    }
+    std::shared_ptr<ElementBlock> block =
+        std::make_shared<ElementBlock>("truss", property, 4 * num_bays);
+    model.blocks_.push_back(block);
+    for (std::size_t i = 0; i < num_bays; ++i) {
+      block->AddElement(2 * i, 2 * i + 2);
+      block->AddElement(2 * i + 1, 2 * i + 3);
+      block->AddElement(2 * i + 1, 2 * i + 2);
+      block->AddElement(2 * i + 2, 2 * i + 3);
+    }
+    model.AddConstraint(cpe::model::dof::kZ, 0.0);
+    model.AddConstraint(cpe::model::dof::kAll, 0.0, 0);
+    model.AddConstraint(cpe::model::dof::kAll, 0.0, 1);
+    model.AddConstraint(cpe::model::dof::kY, -1.0e-3, 1);
+  };
+  const std::vector<std::pair<std::string, cpe::model::dof::Dof> > cases{
+      {"down", cpe::model::dof::kY}, {"side", cpe::model::dof::kX}};
+  for (cpe::model::System system :
+       {cpe::model::System::kFull, cpe::model::System::kReduced}) {
+    cpe::model::Model model;
+    model.system_ = system;
+    build(model);
+    for (const auto& [name, dof] : cases) {
+      model.AddForce(name, dof, -1000.0, tip);
+    }
+    model.Assemble();
+    testing::internal::CaptureStdout();
+    ASSERT_GT(model.SolveLoadCases(), 0);
+    ASSERT_GT(model.SolveLoadCases(), 0);
+    ASSERT_GE(model.Solve(), 0);
+    const std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output.find("Solver:"), output.rfind("Solver:"));
+    ASSERT_EQ(model.load_cases_.size(), cases.size());
+
+    const std::size_t n = model.global_dof_->GetNumRows();
+    for (const auto& [name, dof] : cases) {
+      cpe::model::Model expected;
+      expected.system_ = system;
+      build(expected);
+      expected.AddForce(dof, -1000.0, tip);
+      expected.Assemble();
+      ASSERT_GE(expected.Solve(), 0);
+      const cpe::model::LoadCase& load_case = model.load_cases_.at(name);
+      ASSERT_EQ(load_case.global_dof_->GetNumRows(), n);
+      for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_NEAR((*load_case.global_dof_)[i], (*expected.global_dof_)[i],
+                    1.0e-12);
+      }
+    }
+
+    // A new support renumbers the dof, keeping the forces of each load case
+    model.nodes_.AddNode(2 * num_bays + 2, num_bays + 1.0, 0.0);
+    std::dynamic_pointer_cast<ElementBlock>(model.blocks_[0])
+        ->AddElement(tip, tip + 2);
+    model.AddConstraint(cpe::model::dof::kAll, 0.0, tip + 2);
+    model.Assemble();
+    ASSERT_GT(model.SolveLoadCases(), 0);
+    const cpe::model::LoadCase& down = model.load_cases_.at("down");
+    const std::size_t tip_dof =
+        model.nodes_.GetNodeById(tip).global_dof_index_[1];
+    EXPECT_EQ((*down.applied_force_)[tip_dof], -1000.0);
+  }
+}
+
+TEST(ModelTest, ChangePrescribedValue) {
+  // A bar of four elements with its tip prescribed, prescribed again after
+  // solving; the kept solver and induced forces need another Assemble
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Steel", 200.0e9, 0.3);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 1.0e-4;
+  using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+  for (cpe::model::System system :
+       {cpe::model::System::kFull, cpe::model::System::kReduced}) {
+    cpe::model::Model model;
+    model.system_ = system;
+    std::shared_ptr<ElementBlock> block =
+        std::make_shared<ElementBlock>("bar", property);
+    model.blocks_.push_back(block);
+    for (std::size_t i = 0; i <= 4; ++i) model.nodes_.AddNode(i, 1.0 * i);
+    for (std::size_t i = 0; i < 4; ++i) block->AddElement(i, i + 1);
+    model.AddConstraint(cpe::model::dof::kY, 0.0);
+    model.AddConstraint(cpe::model::dof::kZ, 0.0);
+    model.AddConstraint(cpe::model::dof::kX, 0.0, 0);
+    model.AddConstraint(cpe::model::dof::kX, 1.0, 4);
+    model.Assemble();
+    ASSERT_GE(model.Solve(), 0);
+    const std::size_t mid = model.nodes_.GetNodeById(2).global_dof_index_[0];
+    const std::size_t tip = model.nodes_.GetNodeById(4).global_dof_index_[0];
+    EXPECT_NEAR((*model.global_dof_)[mid], 0.5, 1.0e-12);
+
+    model.AddConstraint(cpe::model::dof::kX, 2.0, 4);
+    EXPECT_THROW(model.Solve(), std::runtime_error);
+    model.Assemble();
+    ASSERT_GE(model.Solve(), 0);
+    EXPECT_NEAR((*model.global_dof_)[mid], 1.0, 1.0e-12);
+    EXPECT_NEAR((*model.global_dof_)[tip], 2.0, 1.0e-12);
+  }
+}
+
+TEST(ModelTest, ChangeOrdering) {
+  // A bar whose nodes were added from both ends inwards, reordered after its
+  // constraints and load were set; they follow the dof to their new numbers
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Steel", 200.0e9, 0.3);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 1.0e-4;
+  using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+  cpe::model::Model model;
+  std::shared_ptr<ElementBlock> block =
+      std::make_shared<ElementBlock>("bar", property);
+  model.blocks_.push_back(block);
+  for (std::size_t id : {0, 8, 1, 7, 2, 6, 3, 5, 4}) {
+    model.nodes_.AddNode(id, 1.0 * id);
+  }
+  for (std::size_t i = 0; i < 8; ++i) block->AddElement(i, i + 1);
+  model.AddConstraint(cpe::model::dof::kY, 0.0);
+  model.AddConstraint(cpe::model::dof::kZ, 0.0);
+  model.AddConstraint(cpe::model::dof::kX, 0.0, 0);
+  model.AddForce(cpe::model::dof::kX, 1000.0, 8);
+  const std::size_t natural_tip =
+      model.nodes_.GetNodeById(8).global_dof_index_[0];
+
+  model.ordering_ = cpe::model::Ordering::kReverseCuthillMcKee;
+  model.Assemble();
+  EXPECT_EQ(model.ordering_report_.ordering_,
+            cpe::model::Ordering::kReverseCuthillMcKee);
+  EXPECT_LT(model.ordering_report_.ordered_.bandwidth_,
+            model.ordering_report_.natural_.bandwidth_);
+  const std::size_t tip = model.nodes_.GetNodeById(8).global_dof_index_[0];
+  EXPECT_NE(tip, natural_tip);
+  EXPECT_EQ((*model.applied_force_)[tip], 1000.0);
+  ASSERT_GE(model.Solve(), 0);
+  EXPECT_NEAR((*model.global_dof_)[tip], 1000.0 * 8.0 / (200.0e9 * 1.0e-4),
+              1.0e-12);
+}
+
 }  // namespace
@@ -43,4 +43,36 @@ class Node {
   double z_;
 };
 
+// A node stored in a NodeList, whose coordinates and dof indices live in
+// separate arrays.  Refers to the stored values rather than copying them.
+template <typename Real, typename DofIndex>
+class NodeReference {
+ public:
+  NodeReference(Real& x, Real& y, Real& z, DofIndex& global_dof_index)
+      : global_dof_index_(global_dof_index), x_(x), y_(y), z_(z) {}
+
+  operator Node() const {
+    Node node(x_, y_, z_);
+    node.global_dof_index_ = global_dof_index_;
+    return node;
+  }
+
+  template <typename Other>
+  inline double GetDistance(const Other& other) const {
+    return std::sqrt(std::pow(other.x_ - x_, 2) + std::pow(other.y_ - y_, 2) +
+                     std::pow(other.z_ - z_, 2));
+  }
+
+  DofIndex& global_dof_index_;
+
+  Real& x_;
+  Real& y_;
+  Real& z_;
+};
+
+using NodeDofIndex = std::array<std::size_t, dof::kNumStrucDof>;
+// Coordinates stay read only, nodes are moved through NodeList::MoveNode
+using MutableNodeReference = NodeReference<const double, NodeDofIndex>;
+using ConstNodeReference = NodeReference<const double, const NodeDofIndex>;
+
 }  // namespace cpe::model
@@ -30,14 +30,40 @@ NodeList::NodeList(std::size_t n) {
 }
 
 void NodeList::AddNode(std::size_t id, double x, double y, double z) {
-  if (node_ids_.count(id) > 0) {
+  std::size_t index = x_.size();
+  if (!index_.Insert(id, index)) {
     std::stringstream msg;
     msg << "Cannot add node id=" << id << ", it already exists.";
     throw std::runtime_error(msg.str());
   }
-  std::size_t index = nodes_.size();
-  nodes_.emplace_back(x, y, z);
-  node_ids_[id] = index;
+  x_.push_back(x);
+  y_.push_back(y);
+  z_.push_back(z);
+  dof_index_.emplace_back();
+  dof_index_.back().fill(dof::kInactiveDof);
+  node_ids_.emplace_back(id, index);
+}
+
+void NodeList::MoveNode(std::size_t id, double x, double y, double z) {
+  const std::size_t index = GetNodeIndex(id);
+  x_[index] = x;
+  y_[index] = y;
+  z_[index] = z;
+  moved_.push_back(index);
+}
+
+void NodeList::GetNodeIndices(std::span<const std::size_t> ids,
+                              std::span<std::size_t> indices) const {
+  index_.Find(ids.data(), ids.size(), indices.data());
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    if (indices[i] == IdMap::kNotFound) ThrowUnknown(ids[i]);
+  }
+}
+
+void NodeList::ThrowUnknown(std::size_t id) {
+  std::stringstream msg;
+  msg << "Unknown node id=" << id << ".";
+  throw std::out_of_range(msg.str());
 }
 
 }  // namespace cpe::model
@@ -21,8 +21,10 @@
 // SOFTWARE.
 #pragma once
 
+#include <cpe/model/idmap.hpp>
 #include <cpe/model/node.hpp>
-#include <map>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace cpe::model {
@@ -31,28 +33,67 @@ class NodeList {
  public:
   NodeList(std::size_t n = 0);
 
+  // (id, index) of every node, in the order they were added
   auto begin() const { return node_ids_.begin(); }
   auto end() const { return node_ids_.end(); }
 
   void AddNode(std::size_t id, double x, double y = 0.0, double z = 0.0);
+  // Moves a node and records its index in the moved nodes, which the model
+  // reassembles incrementally from and then clears
+  void MoveNode(std::size_t id, double x, double y = 0.0, double z = 0.0);
+  void ClearMovedNodes() { moved_.clear(); }
+  std::span<const std::size_t> GetMovedNodes() const { return moved_; }
 
-  Node& GetNodeById(std::size_t id) { return nodes_[GetNodeIndex(id)]; }
-  const Node& GetNodeById(std::size_t id) const {
-    return nodes_[node_ids_.at(id)];
+  MutableNodeReference GetNodeById(std::size_t id) {
+    return (*this)[GetNodeIndex(id)];
   }
-  std::size_t GetNodeIndex(const std::size_t& id) const { return node_ids_.at(id); }
+  ConstNodeReference GetNodeById(std::size_t id) const {
+    return (*this)[GetNodeIndex(id)];
+  }
+  // Throws std::out_of_range for an unknown id
+  std::size_t GetNodeIndex(std::size_t id) const {
+    const std::size_t index = index_.Find(id);
+    if (index == IdMap::kNotFound) ThrowUnknown(id);
+    return index;
+  }
+  // Index of each of ids into indices, which must be as long
+  void GetNodeIndices(std::span<const std::size_t> ids,
+                      std::span<std::size_t> indices) const;
 
-  std::size_t GetNumNodes() { return nodes_.size(); }
-  std::size_t GetNumNodes() const { return nodes_.size(); }
+  std::size_t GetNumNodes() { return x_.size(); }
+  std::size_t GetNumNodes() const { return x_.size(); }
 
-  Node& operator[](std::size_t i) { return nodes_[i]; }
-  const Node& operator[](std::size_t i) const { return nodes_[i]; }
+  // Coordinates and dof indices of every node, indexed by node index
+  std::span<const double> GetX() const { return x_; }
+  std::span<const double> GetY() const { return y_; }
+  std::span<const double> GetZ() const { return z_; }
+  std::span<const NodeDofIndex> GetDofIndices() const { return dof_index_; }
 
-  void Reserve(std::size_t n) { nodes_.reserve(n); }
+  MutableNodeReference operator[](std::size_t i) {
+    return MutableNodeReference(x_[i], y_[i], z_[i], dof_index_[i]);
+  }
+  ConstNodeReference operator[](std::size_t i) const {
+    return ConstNodeReference(x_[i], y_[i], z_[i], dof_index_[i]);
+  }
+
+  void Reserve(std::size_t n) {
+    node_ids_.reserve(n);
+    x_.reserve(n);
+    y_.reserve(n);
+    z_.reserve(n);
+    dof_index_.reserve(n);
+  }
 
  private:
-  std::map<std::size_t, std::size_t> node_ids_;
-  std::vector<Node> nodes_;
+  [[noreturn]] static void ThrowUnknown(std::size_t id);
+
+  IdMap index_;
+  std::vector<std::size_t> moved_;
+  std::vector<std::pair<std::size_t, std::size_t> > node_ids_;
+  std::vector<double> x_;
+  std::vector<double> y_;
+  std::vector<double> z_;
+  std::vector<NodeDofIndex> dof_index_;
 };
 
 }  // namespace cpe::model
@@ -21,9 +21,11 @@
 // SOFTWARE.
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <cpe/model/nodelist.hpp>
 #include <ranges>
 #include <stdexcept>
+#include <vector>
 
 namespace {
 
@@ -58,17 +60,53 @@ TEST(NodeListTest, Access) {
   cpe::model::NodeList node_list;
   node_list.AddNode(id, x, y, z);
 
-  const cpe::model::Node& node1 = node_list[0];
+  const auto node1 = node_list[0];
   EXPECT_EQ(node1.x_, x);
   EXPECT_EQ(node1.y_, y);
   EXPECT_EQ(node1.z_, z);
 
-  const cpe::model::Node& node2 = node_list.GetNodeById(id);
+  const auto node2 = node_list.GetNodeById(id);
   EXPECT_EQ(node2.x_, x);
   EXPECT_EQ(node2.y_, y);
   EXPECT_EQ(node2.z_, z);
 }
 
+TEST(NodeListTest, Arrays) {
+  cpe::model::NodeList node_list;
+  node_list.AddNode(3, 1.0, 2.0, 3.0);
+  node_list.AddNode(1, 4.0, 5.0, 6.0);
+  node_list.MoveNode(1, 7.0, 5.0, 6.0);
+  EXPECT_EQ(node_list.GetMovedNodes().size(), 1);
+  EXPECT_EQ(node_list.GetMovedNodes()[0], 1);
+  node_list.ClearMovedNodes();
+  EXPECT_TRUE(node_list.GetMovedNodes().empty());
+  node_list.GetNodeById(3).global_dof_index_[2] = 11;
+  EXPECT_EQ(node_list.GetX()[0], 1.0);
+  EXPECT_EQ(node_list.GetX()[1], 7.0);
+  EXPECT_EQ(node_list.GetY()[1], 5.0);
+  EXPECT_EQ(node_list.GetZ()[0], 3.0);
+  EXPECT_EQ(node_list.GetDofIndices()[0][2], 11);
+  EXPECT_EQ(node_list.GetDofIndices()[1][2], cpe::model::dof::kInactiveDof);
+  EXPECT_DOUBLE_EQ(node_list[0].GetDistance(node_list[1]), std::sqrt(54.0));
+  const cpe::model::Node node = node_list[1];
+  EXPECT_EQ(node.x_, 7.0);
+}
+
+TEST(NodeListTest, GetNodeIndices) {
+  cpe::model::NodeList node_list;
+  const std::vector<std::size_t> ids{7, 1000000, 3, 12};
+  for (std::size_t id : ids) node_list.AddNode(id, 0.0);
+  std::vector<std::size_t> indices(ids.size());
+  node_list.GetNodeIndices(ids, indices);
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    EXPECT_EQ(indices[i], i);
+    EXPECT_EQ(node_list.GetNodeIndex(ids[i]), i);
+  }
+  const std::vector<std::size_t> unknown{3, 4};
+  EXPECT_THROW(node_list.GetNodeIndices(unknown, indices), std::out_of_range);
+  EXPECT_THROW(node_list.GetNodeIndex(4), std::out_of_range);
+}
+
 TEST(NodeListTest, Iterate) {
   const std::size_t id1 = 5280;
   const std::size_t id2 = 473281;
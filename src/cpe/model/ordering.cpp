@@ -0,0 +1,239 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <algorithm>
+#include <cpe/model/model.hpp>
+#include <cpe/model/ordering.hpp>
+#include <limits>
+#include <queue>
+#include <span>
+#include <utility>
+
+namespace cpe::model {
+
+namespace {
+
+using Adjacency = std::vector<std::vector<std::size_t> >;
+
+constexpr std::size_t kUnreached = std::numeric_limits<std::size_t>::max();
+
+// Breadth-first distances from start, returning the nodes reached in order
+std::vector<std::size_t> LevelStructure(const Adjacency& adjacency,
+                                        std::size_t start,
+                                        std::vector<std::size_t>& distance) {
+  std::vector<std::size_t> reached{start};
+  distance[start] = 0;
+  for (std::size_t k = 0; k < reached.size(); ++k) {
+    for (std::size_t next : adjacency[reached[k]]) {
+      if (distance[next] != kUnreached) continue;
+      distance[next] = distance[reached[k]] + 1;
+      reached.push_back(next);
+    }
+  }
+  return reached;
+}
+
+// George and Liu: restart from the lowest degree node of the last level until
+// the depth stops growing.  Returns the start and end nodes.
+std::pair<std::size_t, std::size_t> PseudoPeripheralPair(
+    const Adjacency& adjacency, std::size_t start) {
+  std::vector<std::size_t> distance(adjacency.size(), kUnreached);
+  std::vector<std::size_t> reached = LevelStructure(adjacency, start, distance);
+  while (true) {
+    const std::size_t depth = distance[reached.back()];
+    std::size_t end = reached.back();
+    for (std::size_t node : reached) {
+      if (distance[node] == depth &&
+          adjacency[node].size() < adjacency[end].size()) {
+        end = node;
+      }
+    }
+    for (std::size_t node : reached) distance[node] = kUnreached;
+    std::vector<std::size_t> from_end =
+        LevelStructure(adjacency, end, distance);
+    const bool deeper = distance[from_end.back()] > depth;
+    for (std::size_t node : from_end) distance[node] = kUnreached;
+    if (!deeper) return {start, end};
+    start = end;
+    reached = LevelStructure(adjacency, start, distance);
+  }
+}
+
+}  // namespace
+
+const char* GetName(Ordering ordering) {
+  switch (ordering) {
+    case Ordering::kNatural:
+      return "natural";
+    case Ordering::kReverseCuthillMcKee:
+      return "reverse Cuthill-McKee";
+    case Ordering::kSloan:
+      return "Sloan";
+  }
+  return "unknown";
+}
+
+std::vector<std::vector<std::size_t> > GetNodeAdjacency(Model& model) {
+  NodeList& nodes = model.nodes_;
+  Adjacency adjacency(nodes.GetNumNodes());
+  std::vector<std::size_t> index;
+  for (const auto& block : model.blocks_) {
+    for (std::size_t e = 0; e < block->GetNumElements(); ++e) {
+      const std::span<const std::size_t> ids = block->GetElementNodes(e);
+      index.resize(ids.size());
+      nodes.GetNodeIndices(ids, index);
+      for (std::size_t na : index) {
+        for (std::size_t nb : index) {
+          if (na != nb) adjacency[na].push_back(nb);
+        }
+      }
+    }
+  }
+  for (std::vector<std::size_t>& neighbours : adjacency) {
+    std::sort(neighbours.begin(), neighbours.end());
+    neighbours.erase(std::unique(neighbours.begin(), neighbours.end()),
+                     neighbours.end());
+  }
+  return adjacency;
+}
+
+std::vector<std::size_t> ReverseCuthillMcKee(const Adjacency& adjacency) {
+  const std::size_t n = adjacency.size();
+  std::vector<std::size_t> order;
+  order.reserve(n);
+  std::vector<bool> numbered(n, false);
+  std::vector<std::size_t> neighbours;
+  for (std::size_t first = 0; first < n; ++first) {
+    if (numbered[first]) continue;
+    const std::size_t start = PseudoPeripheralPair(adjacency, first).first;
+    numbered[start] = true;
+    const std::size_t begin = order.size();
+    order.push_back(start);
+    for (std::size_t k = begin; k < order.size(); ++k) {
+      // Unnumbered neighbours by increasing degree
+      neighbours.clear();
+      for (std::size_t next : adjacency[order[k]]) {
+        if (!numbered[next]) neighbours.push_back(next);
+      }
+      std::stable_sort(neighbours.begin(), neighbours.end(),
+                       [&](std::size_t a, std::size_t b) {
+                         return adjacency[a].size() < adjacency[b].size();
+                       });
+      for (std::size_t next : neighbours) {
+        numbered[next] = true;
+        order.push_back(next);
+      }
+    }
+  }
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+std::vector<std::size_t> Sloan(const Adjacency& adjacency, int degree_weight,
+                               int distance_weight) {
+  enum Status { kInactive, kPreactive, kActive, kPostactive };
+  const std::size_t n = adjacency.size();
+  std::vector<std::size_t> order;
+  order.reserve(n);
+  std::vector<Status> status(n, kInactive);
+  std::vector<long long> priority(n, 0);
+  std::vector<std::size_t> distance(n, kUnreached);
+  std::priority_queue<std::pair<long long, std::size_t> > queue;
+  const auto Raise = [&](std::size_t node) {
+    priority[node] += degree_weight;
+    if (status[node] == kInactive) status[node] = kPreactive;
+    queue.push({priority[node], node});
+  };
+  for (std::size_t first = 0; first < n; ++first) {
+    if (status[first] != kInactive) continue;
+
+    // Nodes far from the end and with few unnumbered neighbours go first
+    const auto [start, end] = PseudoPeripheralPair(adjacency, first);
+    for (std::size_t node : LevelStructure(adjacency, end, distance)) {
+      priority[node] =
+          static_cast<long long>(distance_weight * distance[node]) -
+          static_cast<long long>(degree_weight * (adjacency[node].size() + 1));
+    }
+    status[start] = kPreactive;
+    queue.push({priority[start], start});
+    while (!queue.empty()) {
+      const auto [top, i] = queue.top();
+      queue.pop();
+      if (status[i] == kPostactive || top != priority[i]) continue;
+      if (status[i] == kPreactive) {
+        for (std::size_t j : adjacency[i]) {
+          if (status[j] != kPostactive) Raise(j);
+        }
+      }
+      order.push_back(i);
+      status[i] = kPostactive;
+      for (std::size_t j : adjacency[i]) {
+        if (status[j] != kPreactive) continue;
+        status[j] = kActive;
+        Raise(j);
+        for (std::size_t k : adjacency[j]) {
+          if (status[k] != kPostactive) Raise(k);
+        }
+      }
+    }
+  }
+  return order;
+}
+
+std::vector<std::size_t> Order(Ordering ordering, const Adjacency& adjacency) {
+  switch (ordering) {
+    case Ordering::kReverseCuthillMcKee:
+      return ReverseCuthillMcKee(adjacency);
+    case Ordering::kSloan:
+      return Sloan(adjacency);
+    case Ordering::kNatural:
+      break;
+  }
+  std::vector<std::size_t> order(adjacency.size());
+  for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+  return order;
+}
+
+Profile ComputeProfile(const Adjacency& adjacency,
+                       const std::vector<std::size_t>& num_dof,
+                       const std::vector<std::size_t>& order) {
+  std::vector<std::size_t> first_dof(adjacency.size());
+  std::size_t count = 0;
+  for (std::size_t node : order) {
+    first_dof[node] = count;
+    count += num_dof[node];
+  }
+  Profile result;
+  for (std::size_t i = 0; i < adjacency.size(); ++i) {
+    std::size_t lowest = first_dof[i];
+    for (std::size_t j : adjacency[i]) {
+      if (num_dof[j] > 0) lowest = std::min(lowest, first_dof[j]);
+    }
+    for (std::size_t d = 0; d < num_dof[i]; ++d) {
+      const std::size_t width = first_dof[i] + d - lowest;
+      result.bandwidth_ = std::max(result.bandwidth_, width);
+      result.profile_ += width;
+    }
+  }
+  return result;
+}
+
+}  // namespace cpe::model
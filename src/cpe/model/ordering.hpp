@@ -0,0 +1,72 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace cpe::model {
+
+class Model;
+
+// Order in which the nodes' dof are numbered
+enum class Ordering {
+  kNatural,              // node insertion order
+  kReverseCuthillMcKee,  // narrow bandwidth
+  kSloan,                // small profile
+};
+
+const char* GetName(Ordering ordering);
+
+// Bandwidth and profile (entries from the first nonzero of each row up to the
+// diagonal, excluding it) of the lower triangle of a symmetric matrix
+struct Profile {
+  std::size_t bandwidth_ = 0;
+  std::size_t profile_ = 0;
+};
+
+struct OrderingReport {
+  Ordering ordering_ = Ordering::kNatural;
+  Profile natural_;
+  Profile ordered_;
+};
+
+// Neighbours of each node, by node index, through the elements
+std::vector<std::vector<std::size_t> > GetNodeAdjacency(Model& model);
+
+// Node indices in numbering order.  Each connected component is started from
+// a pseudo-peripheral node found by repeated breadth-first searches.
+std::vector<std::size_t> ReverseCuthillMcKee(
+    const std::vector<std::vector<std::size_t> >& adjacency);
+std::vector<std::size_t> Sloan(
+    const std::vector<std::vector<std::size_t> >& adjacency,
+    int degree_weight = 2, int distance_weight = 1);
+std::vector<std::size_t> Order(
+    Ordering ordering, const std::vector<std::vector<std::size_t> >& adjacency);
+
+// Profile of the matrix coupling every dof of adjacent nodes, with num_dof[i]
+// dof on node i and the nodes numbered in order
+Profile ComputeProfile(const std::vector<std::vector<std::size_t> >& adjacency,
+                       const std::vector<std::size_t>& num_dof,
+                       const std::vector<std::size_t>& order);
+
+}  // namespace cpe::model
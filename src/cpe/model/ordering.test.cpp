@@ -0,0 +1,166 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cpe/model/element.hpp>
+#include <cpe/model/model.hpp>
+#include <cpe/model/ordering.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Adjacency = std::vector<std::vector<std::size_t> >;
+
+// Grid of nx by ny nodes joined to their neighbours, with the nodes numbered
+// in a scrambled order
+Adjacency ScrambledGrid(std::size_t nx, std::size_t ny) {
+  std::vector<std::size_t> label(nx * ny);
+  for (std::size_t i = 0; i < label.size(); ++i) label[i] = i;
+  std::shuffle(label.begin(), label.end(), std::mt19937(5489u));
+  Adjacency adjacency(nx * ny);
+  const auto Join = [&](std::size_t a, std::size_t b) {
+    adjacency[label[a]].push_back(label[b]);
+    adjacency[label[b]].push_back(label[a]);
+  };
+  for (std::size_t j = 0; j < ny; ++j) {
+    for (std::size_t i = 0; i < nx; ++i) {
+      if (i + 1 < nx) Join(j * nx + i, j * nx + i + 1);
+      if (j + 1 < ny) Join(j * nx + i, (j + 1) * nx + i);
+    }
+  }
+  return adjacency;
+}
+
+bool IsPermutation(std::vector<std::size_t> order, std::size_t n) {
+  std::sort(order.begin(), order.end());
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    if (order[i] != i) return false;
+  }
+  return order.size() == n;
+}
+
+TEST(OrderingTest, Path) {
+  // A path numbered from the middle outwards
+  const std::size_t n = 9;
+  Adjacency adjacency(n);
+  const std::vector<std::size_t> label{8, 6, 4, 2, 0, 1, 3, 5, 7};
+  for (std::size_t i = 0; i + 1 < n; ++i) {
+    adjacency[label[i]].push_back(label[i + 1]);
+    adjacency[label[i + 1]].push_back(label[i]);
+  }
+  const std::vector<std::size_t> num_dof(n, 1);
+  const std::vector<std::size_t> natural =
+      cpe::model::Order(cpe::model::Ordering::kNatural, adjacency);
+  EXPECT_EQ(cpe::model::ComputeProfile(adjacency, num_dof, natural).bandwidth_,
+            2);
+  for (const auto& order : {cpe::model::ReverseCuthillMcKee(adjacency),
+                            cpe::model::Sloan(adjacency)}) {
+    ASSERT_TRUE(IsPermutation(order, n));
+    const cpe::model::Profile profile =
+        cpe::model::ComputeProfile(adjacency, num_dof, order);
+    EXPECT_EQ(profile.bandwidth_, 1);
+    EXPECT_EQ(profile.profile_, n - 1);
+  }
+}
+
+TEST(OrderingTest, Grid) {
+  const std::size_t nx = 20;
+  const std::size_t ny = 5;
+  const Adjacency adjacency = ScrambledGrid(nx, ny);
+  const std::vector<std::size_t> num_dof(nx * ny, 3);
+  const cpe::model::Profile natural = cpe::model::ComputeProfile(
+      adjacency, num_dof,
+      cpe::model::Order(cpe::model::Ordering::kNatural, adjacency));
+  const std::vector<std::size_t> rcm =
+      cpe::model::ReverseCuthillMcKee(adjacency);
+  const std::vector<std::size_t> sloan = cpe::model::Sloan(adjacency);
+  ASSERT_TRUE(IsPermutation(rcm, nx * ny));
+  ASSERT_TRUE(IsPermutation(sloan, nx * ny));
+  const cpe::model::Profile rcm_profile =
+      cpe::model::ComputeProfile(adjacency, num_dof, rcm);
+  const cpe::model::Profile sloan_profile =
+      cpe::model::ComputeProfile(adjacency, num_dof, sloan);
+  // Numbered across the short side the bandwidth is about ny nodes
+  EXPECT_LE(rcm_profile.bandwidth_, 3 * (ny + 1));
+  EXPECT_LT(rcm_profile.profile_, natural.profile_ / 5);
+  EXPECT_LT(sloan_profile.profile_, natural.profile_ / 5);
+  EXPECT_LE(sloan_profile.profile_, rcm_profile.profile_);
+}
+
+TEST(OrderingTest, Model) {
+  // A long braced beam with its nodes added in a scrambled order solves the
+  // same in any ordering
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("Steel", 200.0e9, 0.3);
+  std::shared_ptr<cpe::model::Property> property =
+      std::make_shared<cpe::model::Property>("square", material);
+  (*property)["area"] = 1.0e-4;
+  constexpr std::size_t num_bays = 12;
+  std::vector<std::size_t> label(2 * num_bays + 2);
+  for (std::size_t i = 0; i < label.size(); ++i) label[i] = i;
+  std::shuffle(label.begin(), label.end(), std::mt19937(5489u));
+  const std::vector<cpe::model::Ordering> orderings{
+      cpe::model::Ordering::kNatural,
+      cpe::model::Ordering::kReverseCuthillMcKee,
+      cpe::model::Ordering::kSloan};
+  std::vector<double> tip;
+  for (cpe::model::Ordering ordering : orderings) {
+    cpe::model::Model model;
+    model.ordering_ = ordering;
+    for (std::size_t id : label) {
+      model.nodes_.AddNode(id, 1.0 * (id / 2), 1.0 * (id % 2));
+    }
+    using ElementBlock = cpe::model::ElementBlock<cpe::model::Element>;
+    std::shared_ptr<ElementBlock> block =
+        std::make_shared<ElementBlock>("truss", property, 4 * num_bays);
+    model.blocks_.push_back(block);
+    for (std::size_t i = 0; i < num_bays; ++i) {
+      block->AddElement(2 * i, 2 * i + 2);
+      block->AddElement(2 * i + 1, 2 * i + 3);
+      block->AddElement(2 * i + 1, 2 * i + 2);
+      block->AddElement(2 * i + 2, 2 * i + 3);
+    }
+    model.AddConstraint(cpe::model::dof::kZ, 0.0);
+    model.AddConstraint(cpe::model::dof::kAll, 0.0, {0, 1});
+    model.AddForce(cpe::model::dof::kY, -1000.0, 2 * num_bays);
+    model.Assemble();
+    model.Solve(cpe::linearsolver::automatic::Method::kDenseDirect);
+    const std::size_t y =
+        model.nodes_.GetNodeById(2 * num_bays).global_dof_index_[1];
+    tip.push_back((*model.global_dof_)[y]);
+    EXPECT_EQ(model.ordering_report_.ordering_, ordering);
+    if (ordering != cpe::model::Ordering::kNatural) {
+      // Within a bay and a half, of two nodes with three dof each
+      EXPECT_LE(model.ordering_report_.ordered_.bandwidth_, 3 * 2 * 2);
+      EXPECT_LT(model.ordering_report_.ordered_.profile_,
+                model.ordering_report_.natural_.profile_ / 3);
+    }
+  }
+  EXPECT_LT(tip[0], 0.0);
+  EXPECT_NEAR(tip[1], tip[0], 1.0e-9 * std::abs(tip[0]));
+  EXPECT_NEAR(tip[2], tip[0], 1.0e-9 * std::abs(tip[0]));
+}
+
+}  // namespace
@@ -20,10 +20,32 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 #include <cpe/model/property.hpp>
+#include <map>
+#include <mutex>
 
 namespace cpe::model {
 
+std::size_t InternAttribute(const std::string& name) {
+  static std::mutex mutex;
+  static std::map<std::string, std::size_t> slots;
+  std::lock_guard<std::mutex> lock(mutex);
+  return slots.try_emplace(name, slots.size()).first->second;
+}
+
 Property::Property(const std::string& name, std::shared_ptr<Material> material)
     : material_(material), name_(name) {};
 
+void Property::Set(std::size_t slot, double value) {
+  version_++;
+  if (slot >= values_.size()) {
+    values_.resize(slot + 1, 0.0);
+    present_.resize(slot + 1, false);
+  }
+  if (!present_[slot]) {
+    present_[slot] = true;
+    num_attributes_++;
+  }
+  values_[slot] = value;
+}
+
 }  // namespace cpe::model
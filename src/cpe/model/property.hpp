@@ -22,12 +22,16 @@
 #pragma once
 
 #include <cpe/model/material.hpp>
-#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace cpe::model {
 
+// Slot of an attribute name, shared by every Property.  Names are interned
+// on first use, so kernels can look a value up by slot instead of by name.
+std::size_t InternAttribute(const std::string& name);
+
 class Property {
  public:
   Property() = delete;
@@ -38,15 +42,53 @@ class Property {
 
   Property(const std::string& name, std::shared_ptr<Material> material);
 
-  std::size_t GetNumAttributes() { return attributes_.size(); }
+  std::size_t GetNumAttributes() const { return num_attributes_; }
+
+  // Value in a slot, zero when it was never set
+  double Get(std::size_t slot) const {
+    return slot < values_.size() ? values_[slot] : 0.0;
+  }
+
+  // Sets the value in a slot
+  void Set(std::size_t slot, double value);
+
+  // Changes with every value written
+  std::size_t GetVersion() const { return version_; }
+
+  // A value by name or slot that reads like a double, and only counts as a
+  // change through GetVersion when it is assigned
+  class Value {
+   public:
+    Value(Property& property, std::size_t slot)
+        : property_(property), slot_(slot) {}
+    operator double() const { return property_.Get(slot_); }
+    Value& operator=(double value) {
+      property_.Set(slot_, value);
+      return *this;
+    }
+
+   private:
+    Property& property_;
+    const std::size_t slot_;
+  };
 
-  double& operator[](const std::string& key) { return attributes_[key]; }
+  Value operator[](const std::string& key) {
+    return Value(*this, InternAttribute(key));
+  }
+  Value operator[](std::size_t slot) { return Value(*this, slot); }
+  double operator[](const std::string& key) const {
+    return Get(InternAttribute(key));
+  }
+  double operator[](std::size_t slot) const { return Get(slot); }
 
   const std::shared_ptr<Material> material_;
   const std::string name_;
 
  private:
-  std::map<std::string, double> attributes_;
+  std::vector<bool> present_;
+  std::size_t num_attributes_ = 0;
+  std::vector<double> values_;
+  std::size_t version_ = 0;
 };
 
 }  // namespace cpe::model
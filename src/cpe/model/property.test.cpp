@@ -47,4 +47,36 @@ TEST(PropertyTest, Accessor) {
   EXPECT_EQ(property[label], value);
 }
 
+TEST(PropertyTest, Slot) {
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("a", 1.0, 0.1);
+  cpe::model::Property property("property", material);
+  const std::size_t width = cpe::model::InternAttribute("width");
+  const std::size_t depth = cpe::model::InternAttribute("depth");
+  EXPECT_NE(width, depth);
+  EXPECT_EQ(cpe::model::InternAttribute("width"), width);
+  EXPECT_EQ(property.Get(depth), 0.0);
+  property["depth"] = 3.0;
+  EXPECT_EQ(property.Get(depth), 3.0);
+  EXPECT_EQ(property.Get(width), 0.0);
+  property[width] = 2.0;
+  EXPECT_EQ(property["width"], 2.0);
+  EXPECT_EQ(property.GetNumAttributes(), 2);
+}
+
+TEST(PropertyTest, Version) {
+  std::shared_ptr<cpe::model::Material> material =
+      std::make_shared<cpe::model::Material>("a", 1.0, 0.1);
+  cpe::model::Property property("property", material);
+  property["area"] = 2.0;
+  const std::size_t version = property.GetVersion();
+  // Reads, through either operator[], leave the version alone
+  const double area = property["area"];
+  const cpe::model::Property& constant = property;
+  EXPECT_EQ(area * constant["area"], 4.0);
+  EXPECT_EQ(property.GetVersion(), version);
+  property["area"] = 3.0;
+  EXPECT_NE(property.GetVersion(), version);
+}
+
 }  // namespace
@@ -0,0 +1,158 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <cpe/parallel/threadpool.hpp>
+#include <exception>
+#include <memory>
+
+namespace cpe::parallel {
+
+ThreadPool::ThreadPool(std::size_t num_threads, Reduction reduction)
+    : reduction_(reduction) {
+  if (num_threads == 0) {
+    num_threads = std::max(1U, std::thread::hardware_concurrency());
+  }
+  workers_.reserve(num_threads - 1);
+  for (std::size_t i = 1; i < num_threads; ++i) {
+    workers_.emplace_back(&ThreadPool::Work, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+  for (std::thread& worker : workers_) worker.join();
+}
+
+void ThreadPool::ParallelFor(
+    std::size_t n, const std::function<void(std::size_t, std::size_t)>& body) {
+  ParallelForChunks(n, [&body](std::size_t, std::size_t begin,
+                               std::size_t end) { body(begin, end); });
+}
+
+void ThreadPool::ParallelForChunks(
+    std::size_t n,
+    const std::function<void(std::size_t, std::size_t, std::size_t)>& body) {
+  const std::size_t num_chunks = GetNumChunks(n);
+  if (num_chunks <= 1) {
+    body(0, 0, n);
+    return;
+  }
+  std::vector<std::future<void> > futures;
+  futures.reserve(num_chunks - 1);
+  for (std::size_t c = 1; c < num_chunks; ++c) {
+    const std::size_t begin = n * c / num_chunks;
+    const std::size_t end = n * (c + 1) / num_chunks;
+    futures.push_back(
+        Submit([&body, c, begin, end]() { body(c, begin, end); }));
+  }
+  // Every chunk must finish before body goes out of scope, even on error
+  std::exception_ptr error;
+  try {
+    body(0, 0, n / num_chunks);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  for (std::future<void>& future : futures) {
+    try {
+      future.get();
+    } catch (...) {
+      if (!error) error = std::current_exception();
+    }
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+std::size_t ThreadPool::GetNumPartials(std::size_t n) const {
+  if (reduction_ == Reduction::kFast) return GetNumChunks(n);
+  return (n + kReductionBlockSize - 1) / kReductionBlockSize;
+}
+
+void ThreadPool::ParallelReduce(
+    std::size_t n,
+    const std::function<void(std::size_t, std::size_t, std::size_t)>& body) {
+  if (reduction_ == Reduction::kFast) {
+    ParallelForChunks(n, body);
+    return;
+  }
+  ParallelFor(GetNumPartials(n), [&](std::size_t first, std::size_t last) {
+    for (std::size_t block = first; block < last; ++block) {
+      body(block, block * kReductionBlockSize,
+           std::min(n, (block + 1) * kReductionBlockSize));
+    }
+  });
+}
+
+std::vector<std::future<void> > ThreadPool::ParallelReduceAsync(
+    std::size_t n,
+    const std::function<void(std::size_t, std::size_t, std::size_t)>& body) {
+  // The tasks may outlive the caller's reference to body
+  auto shared = std::make_shared<
+      std::function<void(std::size_t, std::size_t, std::size_t)> >(body);
+  const std::size_t num_partials = GetNumPartials(n);
+  std::vector<std::future<void> > futures;
+  futures.reserve(num_partials);
+  for (std::size_t p = 0; p < num_partials; ++p) {
+    const std::size_t begin = reduction_ == Reduction::kFast
+                                  ? n * p / num_partials
+                                  : p * kReductionBlockSize;
+    const std::size_t end = reduction_ == Reduction::kFast
+                                ? n * (p + 1) / num_partials
+                                : std::min(n, (p + 1) * kReductionBlockSize);
+    futures.push_back(
+        Submit([shared, p, begin, end]() { (*shared)(p, begin, end); }));
+  }
+  return futures;
+}
+
+std::future<void> ThreadPool::Submit(std::function<void()> task) {
+  std::packaged_task<void()> packaged(std::move(task));
+  std::future<void> future = packaged.get_future();
+  if (workers_.empty()) {
+    packaged();
+    return future;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push(std::move(packaged));
+  }
+  condition_.notify_one();
+  return future;
+}
+
+void ThreadPool::Work() {
+  while (true) {
+    std::packaged_task<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+      if (stopping_ && tasks_.empty()) return;
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+}  // namespace cpe::parallel
@@ -0,0 +1,132 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace cpe::parallel {
+
+enum class Reduction {
+  // One partial result per thread, so sums vary with the number of threads
+  kFast,
+  // Partial results over fixed blocks, combined in a fixed tree, so sums are
+  // bitwise identical whatever the number of threads
+  kDeterministic,
+};
+
+// Block size of deterministic reductions
+constexpr std::size_t kReductionBlockSize = 1024;
+
+// A fixed-size pool of worker threads.  The calling thread counts as one of
+// the num_threads threads: it runs the first chunk of every ParallelFor, so a
+// pool of one thread runs everything inline.
+class ThreadPool {
+ public:
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  explicit ThreadPool(std::size_t num_threads = 0,
+                      Reduction reduction = Reduction::kFast);
+  ~ThreadPool();
+
+  std::size_t GetNumThreads() const { return workers_.size() + 1; }
+  Reduction GetReduction() const { return reduction_; }
+
+  std::size_t GetNumChunks(std::size_t n) const {
+    return std::min(GetNumThreads(), n);
+  }
+
+  // Splits [0, n) into GetNumChunks(n) contiguous chunks, calls
+  // body(begin, end) for each chunk concurrently and waits for all of them.
+  void ParallelFor(std::size_t n,
+                   const std::function<void(std::size_t, std::size_t)>& body);
+
+  // As ParallelFor, but also passes the chunk index, body(chunk, begin, end),
+  // for callers that keep per-chunk partial results.
+  void ParallelForChunks(
+      std::size_t n,
+      const std::function<void(std::size_t, std::size_t, std::size_t)>& body);
+
+  // Number of partial results a reduction over [0, n) produces: one per chunk
+  // in Reduction::kFast mode, or one per kReductionBlockSize block in
+  // Reduction::kDeterministic mode whatever the number of threads.
+  std::size_t GetNumPartials(std::size_t n) const;
+
+  // Calls body(partial, begin, end) concurrently for each of the
+  // GetNumPartials(n) ranges, for callers that combine the per-range partial
+  // results with PairwiseSum.
+  void ParallelReduce(
+      std::size_t n,
+      const std::function<void(std::size_t, std::size_t, std::size_t)>& body);
+
+  // As ParallelReduce, but queues the ranges and returns at once with one
+  // future per range, so the calling thread can overlap other work with the
+  // reduction.  Every future must be waited on before using the partials.
+  std::vector<std::future<void> > ParallelReduceAsync(
+      std::size_t n,
+      const std::function<void(std::size_t, std::size_t, std::size_t)>& body);
+
+  std::future<void> Submit(std::function<void()> task);
+
+ private:
+  void Work();
+
+  const Reduction reduction_;
+  std::condition_variable condition_;
+  std::mutex mutex_;
+  bool stopping_ = false;
+  std::queue<std::packaged_task<void()> > tasks_;
+  std::vector<std::thread> workers_;
+};
+
+inline void Accumulate(double& sum, double value) { sum += value; }
+
+template <std::size_t N>
+void Accumulate(std::array<double, N>& sum,
+                const std::array<double, N>& value) {
+  for (std::size_t i = 0; i < N; ++i) sum[i] += value[i];
+}
+
+// Sums partials in a fixed pairwise tree, so the result depends only on the
+// partials and their order
+template <typename T>
+T PairwiseSum(std::vector<T> partials) {
+  if (partials.empty()) return T{};
+  for (std::size_t stride = 1; stride < partials.size(); stride *= 2) {
+    for (std::size_t i = 0; i + stride < partials.size(); i += 2 * stride) {
+      Accumulate(partials[i], partials[i + stride]);
+    }
+  }
+  return partials[0];
+}
+
+}  // namespace cpe::parallel
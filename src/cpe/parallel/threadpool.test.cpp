@@ -0,0 +1,157 @@
+// MIT License
+//
+// Copyright (c) 2025 Steven E. Lamberson, Jr.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cpe/parallel/threadpool.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+TEST(ThreadPoolTest, Create) {
+  cpe::parallel::ThreadPool serial(1);
+  EXPECT_EQ(serial.GetNumThreads(), 1);
+  cpe::parallel::ThreadPool pool(4);
+  EXPECT_EQ(pool.GetNumThreads(), 4);
+  cpe::parallel::ThreadPool automatic;
+  EXPECT_GE(automatic.GetNumThreads(), 1);
+}
+
+TEST(ThreadPoolTest, ParallelFor) {
+  constexpr std::size_t n = 1001;
+  for (std::size_t num_threads : {1, 2, 3, 8}) {
+    cpe::parallel::ThreadPool pool(num_threads);
+    std::vector<int> visits(n, 0);
+    std::atomic<std::size_t> num_chunks = 0;
+    pool.ParallelFor(n, [&visits, &num_chunks](std::size_t b, std::size_t e) {
+      num_chunks++;
+      for (std::size_t i = b; i < e; ++i) visits[i]++;
+    });
+    EXPECT_EQ(num_chunks, num_threads);
+    for (std::size_t i = 0; i < n; ++i) EXPECT_EQ(visits[i], 1);
+  }
+}
+
+TEST(ThreadPoolTest, ParallelForSmall) {
+  cpe::parallel::ThreadPool pool(8);
+  std::vector<int> visits(3, 0);
+  pool.ParallelFor(3, [&visits](std::size_t b, std::size_t e) {
+    for (std::size_t i = b; i < e; ++i) visits[i]++;
+  });
+  EXPECT_EQ(visits, std::vector<int>({1, 1, 1}));
+}
+
+TEST(ThreadPoolTest, ParallelForChunks) {
+  constexpr std::size_t n = 10;
+  cpe::parallel::ThreadPool pool(3);
+  EXPECT_EQ(pool.GetNumChunks(n), 3);
+  EXPECT_EQ(pool.GetNumChunks(2), 2);
+  std::vector<std::size_t> chunk_of(n, n);
+  pool.ParallelForChunks(
+      n, [&chunk_of](std::size_t c, std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) chunk_of[i] = c;
+      });
+  EXPECT_EQ(chunk_of,
+            std::vector<std::size_t>({0, 0, 0, 1, 1, 1, 2, 2, 2, 2}));
+}
+
+TEST(ThreadPoolTest, ParallelReduce) {
+  using cpe::parallel::kReductionBlockSize;
+  constexpr std::size_t n = 5 * kReductionBlockSize / 2;
+  cpe::parallel::ThreadPool fast(3);
+  EXPECT_EQ(fast.GetReduction(), cpe::parallel::Reduction::kFast);
+  EXPECT_EQ(fast.GetNumPartials(n), 3);
+  for (std::size_t num_threads : {1, 2, 3, 8}) {
+    cpe::parallel::ThreadPool pool(num_threads,
+                                   cpe::parallel::Reduction::kDeterministic);
+    EXPECT_EQ(pool.GetNumPartials(n), 3);
+    EXPECT_EQ(pool.GetNumPartials(0), 0);
+    std::vector<std::size_t> partial_of(n, n);
+    pool.ParallelReduce(
+        n, [&partial_of](std::size_t p, std::size_t b, std::size_t e) {
+          for (std::size_t i = b; i < e; ++i) partial_of[i] = p;
+        });
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(partial_of[i], i / kReductionBlockSize);
+    }
+  }
+}
+
+TEST(ThreadPoolTest, ParallelReduceAsync) {
+  using cpe::parallel::kReductionBlockSize;
+  constexpr std::size_t n = 5 * kReductionBlockSize / 2;
+  for (cpe::parallel::Reduction reduction :
+       {cpe::parallel::Reduction::kFast,
+        cpe::parallel::Reduction::kDeterministic}) {
+    cpe::parallel::ThreadPool pool(3, reduction);
+    std::vector<double> partials(pool.GetNumPartials(n), 0.0);
+    std::vector<std::future<void> > futures = pool.ParallelReduceAsync(
+        n, [&partials](std::size_t p, std::size_t b, std::size_t e) {
+          for (std::size_t i = b; i < e; ++i) partials[p] += 1.0;
+        });
+    EXPECT_EQ(futures.size(), partials.size());
+    // The pool stays free for other work while the ranges run
+    int value = 0;
+    pool.ParallelFor(4, [&value](std::size_t b, std::size_t) {
+      if (b == 0) value = 42;
+    });
+    for (std::future<void>& future : futures) future.get();
+    EXPECT_EQ(value, 42);
+    EXPECT_EQ(cpe::parallel::PairwiseSum(partials), static_cast<double>(n));
+  }
+}
+
+TEST(ThreadPoolTest, PairwiseSum) {
+  EXPECT_EQ(cpe::parallel::PairwiseSum(std::vector<double>()), 0.0);
+  EXPECT_EQ(cpe::parallel::PairwiseSum(std::vector<double>({1.0, 2.0, 3.0})),
+            6.0);
+  // ((1e16 + 1) + (-1e16 + 1)) loses both ones, a left-to-right sum keeps one
+  EXPECT_EQ(cpe::parallel::PairwiseSum(
+                std::vector<double>({1.0e16, 1.0, -1.0e16, 1.0})),
+            0.0);
+  const std::vector<std::array<double, 2> > partials(
+      {{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}});
+  const std::array<double, 2> sums = cpe::parallel::PairwiseSum(partials);
+  EXPECT_EQ(sums[0], 9.0);
+  EXPECT_EQ(sums[1], 12.0);
+}
+
+TEST(ThreadPoolTest, Submit) {
+  cpe::parallel::ThreadPool pool(2);
+  int value = 0;
+  std::future<void> future = pool.Submit([&value]() { value = 42; });
+  future.get();
+  EXPECT_EQ(value, 42);
+}
+
+TEST(ThreadPoolTest, Exception) {
+  cpe::parallel::ThreadPool pool(2);
+  EXPECT_THROW(pool.ParallelFor(10,
+                                [](std::size_t b, std::size_t) {
+                                  if (b > 0) throw std::runtime_error("chunk");
+                                }),
+               std::runtime_error);
+}
+
+}  // namespace